@@ -0,0 +1,350 @@
+#include "BenchmarkHarness.h"
+#include "BenchmarkSuites.h"
+#include "BitParallelMatcher.h"
+#include "DeterministicFiniteAutomaton.h"
+#include "MatchPlanner.h"
+#include "NondeterministicFiniteAutomaton.h"
+#include "RegexParser.h"
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+
+#ifndef LFC_CORPUS_DIR
+#define LFC_CORPUS_DIR "corpus"
+#endif
+
+namespace {
+    struct Pattern {
+        string name;
+        string regex;
+    };
+
+    // automatele unui tipar, construite o singura data si refolosite de benchmark-uri
+    struct CompiledPattern {
+        string postfix;
+        NondeterministicFiniteAutomaton nfa;
+        DeterministicFiniteAutomaton dfa;
+        DeterministicFiniteAutomaton minimal;
+    };
+
+    const size_t wordLengths[] = { 16, 256, 4096, 65536 };
+    const size_t bytesPerBatch = 65536;
+
+    vector<Pattern> loadCorpus(const string& path) {
+        vector<Pattern> patterns;
+        ifstream in(path);
+        if (!in.is_open()) {
+            cerr << "Eroare: nu s-a putut deschide corpusul " << path << endl;
+            return patterns;
+        }
+        string line;
+        while (getline(in, line)) {
+            istringstream fields(line);
+            Pattern pattern;
+            if (!(fields >> pattern.name) || pattern.name[0] == '#')
+                continue;
+            if (fields >> pattern.regex)
+                patterns.push_back(pattern);
+        }
+        return patterns;
+    }
+
+    shared_ptr<CompiledPattern> compile(const Pattern& pattern) {
+        auto compiled = make_shared<CompiledPattern>();
+        compiled->postfix = toPostfix(insertConcatenation(pattern.regex));
+        compiled->nfa = regexToNFA_thompson(compiled->postfix);
+        compiled->dfa = compiled->nfa.convertToDFA();
+        compiled->minimal = compiled->dfa.minimize();
+        return compiled;
+    }
+
+    void registerCompressedPattern(const Pattern& pattern, function<shared_ptr<CompiledPattern>()> compiled) {
+        registerBenchmark("BM_CheckWordCompressed/" + pattern.name + "/4096", [compiled](BenchmarkState& state) {
+            auto c = compiled();
+            DeterministicFiniteAutomaton dfa = c->dfa;
+            dfa.setTransitionStorage(TransitionStorage::Compressed);
+            vector<string> words = generateWalkWords(dfa, 4096, 4096);
+            size_t accepted = 0;
+            while (state.keepRunning())
+                for (const string& word : words)
+                    accepted += dfa.checkWord(word);
+            benchmarkSink(accepted);
+            state.bytes_processed = totalBytes(words);
+            state.counters["comb_bytes"] = (double)dfa.transitionTableBytes();
+            dfa.setTransitionStorage(TransitionStorage::Dense);
+            state.counters["dense_bytes"] = (double)dfa.transitionTableBytes();
+        });
+    }
+
+    // motorul Glushkov bit-paralel, doar pentru tiparele care incap in 64 de biti
+    void registerBitParallelPattern(const Pattern& pattern, function<shared_ptr<CompiledPattern>()> compiled) {
+        registerBenchmark("BM_BitParallelBuild/" + pattern.name, [pattern](BenchmarkState& state) {
+            string postfix = toPostfix(insertConcatenation(pattern.regex));
+            Node* root = buildSyntaxTree(postfix);
+            if (!BitParallelMatcher::fits(root)) {
+                deleteSyntaxTree(root);
+                state.skip("prea multe pozitii pentru 64 de biti");
+                return;
+            }
+            deleteSyntaxTree(root);
+            while (state.keepRunning()) {
+                Node* tree = buildSyntaxTree(postfix);
+                BitParallelMatcher matcher(tree);
+                benchmarkSink(matcher.positions());
+                deleteSyntaxTree(tree);
+            }
+        });
+
+        registerBenchmark("BM_BitParallel/" + pattern.name + "/4096", [pattern, compiled](BenchmarkState& state) {
+            Node* root = buildSyntaxTree(toPostfix(insertConcatenation(pattern.regex)));
+            if (!BitParallelMatcher::fits(root)) {
+                deleteSyntaxTree(root);
+                state.skip("prea multe pozitii pentru 64 de biti");
+                return;
+            }
+            BitParallelMatcher matcher(root);
+            deleteSyntaxTree(root);
+
+            vector<string> words = generateWalkWords(compiled()->dfa, 4096, 4096);
+            size_t accepted = 0;
+            while (state.keepRunning())
+                for (const string& word : words)
+                    accepted += matcher.checkWord(word);
+            benchmarkSink(accepted);
+            state.bytes_processed = totalBytes(words);
+            state.counters["positions"] = matcher.positions();
+        });
+    }
+
+    // motoarele fara determinizare completa si planificatorul care alege intre ele
+    void registerPlannerPattern(const Pattern& pattern, function<shared_ptr<CompiledPattern>()> compiled) {
+        registerBenchmark("BM_LazyDFA/" + pattern.name + "/4096", [compiled](BenchmarkState& state) {
+            auto c = compiled();
+            LazyDeterministicAutomaton lazy(c->nfa);
+            vector<string> words = generateWalkWords(c->dfa, 4096, 4096);
+            size_t accepted = 0;
+            while (state.keepRunning())
+                for (const string& word : words)
+                    accepted += lazy.checkWord(word);
+            benchmarkSink(accepted);
+            state.bytes_processed = totalBytes(words);
+            state.counters["cached_states"] = (double)lazy.cachedStates();
+            state.counters["flushes"] = (double)lazy.cacheFlushes();
+        });
+
+        registerBenchmark("BM_NFASimulation/" + pattern.name + "/256", [compiled](BenchmarkState& state) {
+            auto c = compiled();
+            vector<string> words = generateWalkWords(c->dfa, 256, 256);
+            words.resize(min<size_t>(words.size(), 16));
+            size_t accepted = 0;
+            while (state.keepRunning())
+                for (const string& word : words)
+                    accepted += c->nfa.checkWord(word);
+            benchmarkSink(accepted);
+            state.bytes_processed = totalBytes(words);
+        });
+
+        // constructia motorului ales plus parcurgerea volumului anuntat planificatorului
+        for (size_t volume : { size_t(4096), size_t(1) << 20 }) {
+            string name = "BM_Planned/" + pattern.name + "/" + to_string(volume);
+            registerBenchmark(name, [pattern, compiled, volume](BenchmarkState& state) {
+                vector<string> words = generateWalkWords(compiled()->dfa, 256, 256);
+                PlannerOptions options;
+                options.expectedInputBytes = volume;
+                size_t accepted = 0;
+                MatchEngine engine = MatchEngine::DFA;
+                while (state.keepRunning()) {
+                    PlannedMatcher matcher(pattern.regex, options);
+                    engine = matcher.getPlan().engine;
+                    //fiecare cuvant e o linie: numaram si terminatorul, ca in modul batch
+                    for (size_t scanned = 0, i = 0; scanned < volume; scanned += words[i].size() + 1, i = (i + 1) % words.size())
+                        accepted += matcher.checkWord(words[i]);
+                }
+                benchmarkSink(accepted);
+                state.bytes_processed = volume;
+                state.counters["engine"] = (double)engine;
+            });
+        }
+    }
+
+    // extragerea grupurilor cu AFD-ul etichetat, fata de checkWord pe acelasi automat
+    void registerTaggedPattern(const Pattern& pattern, function<shared_ptr<CompiledPattern>()> compiled) {
+        for (bool withGroups : { false, true }) {
+            string name = string(withGroups ? "BM_TaggedMatch/" : "BM_TaggedCheckWord/") + pattern.name + "/4096";
+            registerBenchmark(name, [pattern, compiled, withGroups](BenchmarkState& state) {
+                unique_ptr<TaggedDeterministicAutomaton> tagged;
+                try {
+                    tagged = make_unique<TaggedDeterministicAutomaton>(RegexToTaggedDFA(pattern.regex));
+                }
+                catch (const exception& e) {
+                    state.skip(e.what());
+                    return;
+                }
+
+                vector<string> words = generateWalkWords(compiled()->dfa, 4096, 4096);
+                vector<Submatch> groups;
+                size_t accepted = 0;
+                while (state.keepRunning())
+                    for (const string& word : words)
+                        accepted += withGroups ? tagged->match(word, groups) : tagged->checkWord(word);
+                benchmarkSink(accepted);
+                state.bytes_processed = totalBytes(words);
+                state.counters["groups"] = tagged->groupCount();
+                state.counters["tdfa_states"] = (double)tagged->stateCount();
+            });
+        }
+    }
+
+    void registerPattern(const Pattern& pattern) {
+        // compilarea se face la prima rulare, in afara zonei cronometrate
+        auto cache = make_shared<shared_ptr<CompiledPattern>>();
+        auto compiled = [cache, pattern]() {
+            if (!*cache)
+                *cache = compile(pattern);
+            return *cache;
+        };
+
+        registerBenchmark("BM_Parse/" + pattern.name, [pattern](BenchmarkState& state) {
+            while (state.keepRunning()) {
+                string postfix = toPostfix(insertConcatenation(pattern.regex));
+                benchmarkSink(postfix.size());
+            }
+            state.bytes_processed = pattern.regex.size();
+        });
+
+        registerBenchmark("BM_Thompson/" + pattern.name, [compiled](BenchmarkState& state) {
+            auto c = compiled();
+            while (state.keepRunning()) {
+                NondeterministicFiniteAutomaton nfa = regexToNFA_thompson(c->postfix);
+                benchmarkSink(nfa.getQ().size());
+            }
+            state.counters["nfa_states"] = (double)c->nfa.getQ().size();
+        });
+
+        registerBenchmark("BM_ConvertToDFA/" + pattern.name, [compiled](BenchmarkState& state) {
+            auto c = compiled();
+            while (state.keepRunning()) {
+                DeterministicFiniteAutomaton dfa = c->nfa.convertToDFA();
+                benchmarkSink(dfa.getQ().size());
+            }
+            state.counters["dfa_states"] = (double)c->dfa.getQ().size();
+        });
+
+        registerBenchmark("BM_Minimize/" + pattern.name, [compiled](BenchmarkState& state) {
+            auto c = compiled();
+            while (state.keepRunning()) {
+                DeterministicFiniteAutomaton minimal = c->dfa.minimize();
+                benchmarkSink(minimal.getQ().size());
+            }
+            state.counters["dfa_states"] = (double)c->dfa.getQ().size();
+            state.counters["min_states"] = (double)c->minimal.getQ().size();
+        });
+
+        for (size_t length : wordLengths) {
+            string name = "BM_CheckWord/" + pattern.name + "/" + to_string(length);
+            registerBenchmark(name, [compiled, length](BenchmarkState& state) {
+                auto c = compiled();
+                vector<string> words = generateWalkWords(c->dfa, length, (unsigned)length);
+                size_t accepted = 0;
+                while (state.keepRunning())
+                    for (const string& word : words)
+                        accepted += c->dfa.checkWord(word);
+                benchmarkSink(accepted);
+                state.bytes_processed = totalBytes(words);
+                state.items_processed = words.size();
+                state.counters["accepted"] = (double)accepted / state.iterations() / words.size();
+            });
+        }
+
+        registerCompressedPattern(pattern, compiled);
+        registerBitParallelPattern(pattern, compiled);
+        registerPlannerPattern(pattern, compiled);
+        registerTaggedPattern(pattern, compiled);
+    }
+
+    bool startsWith(const string& arg, const string& prefix, string& value) {
+        if (arg.compare(0, prefix.size(), prefix) != 0)
+            return false;
+        value = arg.substr(prefix.size());
+        return true;
+    }
+}
+
+// cuvinte obtinute prin mers aleator in AFD; automatul nu are stari moarte, deci orice prefix
+// poate fi completat la un cuvant acceptat. Un cuvant se termina la lungimea ceruta sau cand
+// mersul ajunge intr-o stare fara tranzitii (finala): la limbajele finite cuvintele raman
+// scurte, dar sunt acceptate, nu respinse dupa cativa octeti. Generam ~64 KB in total.
+vector<string> generateWalkWords(const DeterministicFiniteAutomaton& dfa, size_t length, unsigned seed) {
+    mt19937 rng(seed);
+    map<int, vector<pair<char, int>>> outgoing;
+    for (const auto& entry : dfa.getDelta())
+        outgoing[entry.first.first].push_back({ entry.first.second, entry.second });
+
+    vector<string> words;
+    size_t generated = 0;
+    while (generated < bytesPerBatch) {
+        string word;
+        word.reserve(length);
+        int state = dfa.getQ0();
+        while (word.size() < length) {
+            auto it = outgoing.find(state);
+            if (it == outgoing.end())
+                break;
+            const auto& edge = it->second[rng() % it->second.size()];
+            word += edge.first;
+            state = edge.second;
+        }
+        //limbajul {lambda} sau vid: nu exista cuvinte nevide de parcurs
+        if (word.empty() && !words.empty())
+            break;
+        generated += max<size_t>(1, word.size());
+        words.push_back(std::move(word));
+    }
+    return words;
+}
+
+size_t totalBytes(const vector<string>& words) {
+    size_t bytes = 0;
+    for (const string& word : words)
+        bytes += word.size();
+    return bytes;
+}
+
+int main(int argc, char* argv[])
+{
+    BenchmarkOptions options;
+    string corpus = string(LFC_CORPUS_DIR) + "/patterns.txt";
+
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i], value;
+        if (startsWith(arg, "--benchmark_filter=", value))
+            options.filter = value;
+        else if (startsWith(arg, "--benchmark_min_time=", value))
+            options.min_time = stod(value);
+        else if (startsWith(arg, "--benchmark_format=", value))
+            options.csv = value == "csv";
+        else if (startsWith(arg, "--corpus=", value))
+            corpus = value;
+        else {
+            cerr << "Utilizare: " << argv[0] << " [--benchmark_filter=SUBSIR] [--benchmark_min_time=SECUNDE]"
+                << " [--benchmark_format=console|csv] [--corpus=FISIER]" << endl;
+            return 2;
+        }
+    }
+
+    vector<Pattern> patterns = loadCorpus(corpus);
+    if (patterns.empty())
+        return 1;
+
+    map<string, string> regexByName;
+    for (const Pattern& pattern : patterns) {
+        registerPattern(pattern);
+        regexByName[pattern.name] = pattern.regex;
+    }
+    registerStateLayoutBenchmarks();
+    registerGeneratedMatcherBenchmarks(regexByName);
+
+    return runBenchmarks(options);
+}
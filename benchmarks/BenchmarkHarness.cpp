@@ -0,0 +1,189 @@
+#include "BenchmarkHarness.h"
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+#ifdef __linux__
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    struct RegisteredBenchmark {
+        string name;
+        function<void(BenchmarkState&)> body;
+    };
+
+    vector<RegisteredBenchmark>& registry() {
+        static vector<RegisteredBenchmark> benchmarks;
+        return benchmarks;
+    }
+
+    volatile size_t sink_value = 0;
+
+#ifdef __linux__
+    int openCacheCounter(uint64_t cache) {
+        perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HW_CACHE;
+        attr.config = cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        return (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+    }
+
+    uint64_t readCounter(int fd) {
+        uint64_t value = 0;
+        if (fd < 0 || read(fd, &value, sizeof(value)) != (ssize_t)sizeof(value))
+            return 0;
+        return value;
+    }
+#endif
+
+    string humanRate(double perSecond, const char* unit) {
+        const char* prefixes[] = { "", "k", "M", "G", "T" };
+        int p = 0;
+        while (perSecond >= 1000.0 && p < 4) {
+            perSecond /= 1000.0;
+            p++;
+        }
+        char buffer[64];
+        snprintf(buffer, sizeof(buffer), "%.3g%s%s/s", perSecond, prefixes[p], unit);
+        return buffer;
+    }
+}
+
+void registerBenchmark(const string& name, function<void(BenchmarkState&)> body) {
+    registry().push_back({ name, move(body) });
+}
+
+void benchmarkSink(size_t value) {
+    sink_value = sink_value + value;
+}
+
+CacheMissCounters::CacheMissCounters() {
+#ifdef __linux__
+    l1_fd = openCacheCounter(PERF_COUNT_HW_CACHE_L1D);
+    last_level_fd = openCacheCounter(PERF_COUNT_HW_CACHE_LL);
+#endif
+}
+
+CacheMissCounters::~CacheMissCounters() {
+#ifdef __linux__
+    if (l1_fd >= 0)
+        close(l1_fd);
+    if (last_level_fd >= 0)
+        close(last_level_fd);
+#endif
+}
+
+void CacheMissCounters::start() {
+#ifdef __linux__
+    for (int fd : { l1_fd, last_level_fd })
+        if (fd >= 0) {
+            ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+}
+
+void CacheMissCounters::stop() {
+#ifdef __linux__
+    for (int fd : { l1_fd, last_level_fd })
+        if (fd >= 0)
+            ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+#endif
+}
+
+uint64_t CacheMissCounters::l1Misses() const {
+#ifdef __linux__
+    return readCounter(l1_fd);
+#else
+    return 0;
+#endif
+}
+
+uint64_t CacheMissCounters::lastLevelMisses() const {
+#ifdef __linux__
+    return readCounter(last_level_fd);
+#else
+    return 0;
+#endif
+}
+
+int runBenchmarks(const BenchmarkOptions& options) {
+    if (options.csv)
+        cout << "name,iterations,real_time_ns,bytes_per_second,items_per_second,counters,error\n";
+    else {
+        printf("%-56s %15s %12s  %s\n", "Benchmark", "Time", "Iterations", "UserCounters...");
+        printf("%s\n", string(100, '-').c_str());
+    }
+
+    int ran = 0;
+    for (const auto& benchmark : registry()) {
+        if (!options.filter.empty() && benchmark.name.find(options.filter) == string::npos)
+            continue;
+        ran++;
+
+        //crestem numarul de iteratii pana cand masurarea dureaza suficient
+        uint64_t iterations = 1;
+        BenchmarkState state(iterations);
+        while (true) {
+            state = BenchmarkState(iterations);
+            benchmark.body(state);
+            if (!state.skip_reason.empty())
+                break;
+            double seconds = state.seconds();
+            if (seconds >= options.min_time || iterations >= 1000000000ULL)
+                break;
+            double factor = seconds > 0 ? options.min_time * 1.4 / seconds : 10.0;
+            factor = min(max(factor, 2.0), 10.0);
+            iterations = (uint64_t)(iterations * factor);
+        }
+
+        string counters;
+        for (const auto& counter : state.counters) {
+            char buffer[96];
+            snprintf(buffer, sizeof(buffer), "%s%s=%g", counters.empty() ? "" : " ",
+                counter.first.c_str(), counter.second);
+            counters += buffer;
+        }
+
+        double seconds = state.seconds();
+        double nsPerIteration = state.iterations() ? seconds * 1e9 / state.iterations() : 0;
+        double bytesPerSecond = seconds > 0 ? state.bytes_processed * state.iterations() / seconds : 0;
+        double itemsPerSecond = seconds > 0 ? state.items_processed * state.iterations() / seconds : 0;
+
+        if (options.csv) {
+            cout << '"' << benchmark.name << "\"," << state.iterations() << ',' << nsPerIteration << ','
+                << bytesPerSecond << ',' << itemsPerSecond << ",\"" << counters << "\",\""
+                << state.skip_reason << "\"\n";
+            continue;
+        }
+
+        if (!state.skip_reason.empty()) {
+            printf("%-56s ERROR: %s\n", benchmark.name.c_str(), state.skip_reason.c_str());
+            continue;
+        }
+
+        string extra;
+        if (state.bytes_processed)
+            extra += "bytes_per_second=" + humanRate(bytesPerSecond, "B") + " ";
+        if (state.items_processed)
+            extra += "items_per_second=" + humanRate(itemsPerSecond, "") + " ";
+        extra += counters;
+        printf("%-56s %12.0f ns %12llu  %s\n", benchmark.name.c_str(), nsPerIteration,
+            (unsigned long long)state.iterations(), extra.c_str());
+    }
+    cout.flush();
+
+    if (ran == 0) {
+        cerr << "Niciun benchmark nu corespunde filtrului '" << options.filter << "'" << endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,81 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// Mini harness in stilul Google Benchmark: fiecare benchmark ruleaza un numar
+// crescator de iteratii pana depaseste timpul minim, apoi raporteaza ns/iteratie.
+class BenchmarkState
+{
+private:
+    uint64_t max_iterations;
+    uint64_t done_iterations = 0;
+    chrono::steady_clock::time_point start_time;
+    chrono::steady_clock::duration elapsed{};
+    bool running = false;
+
+public:
+    uint64_t bytes_processed = 0;   // per iteratie
+    uint64_t items_processed = 0;   // per iteratie
+    map<string, double> counters;   // valori afisate ca atare (ex: numar de stari)
+    string skip_reason;
+
+    explicit BenchmarkState(uint64_t iterations) : max_iterations(iterations) {}
+
+    // bucla de masurare: while (state.keepRunning()) { ... }
+    bool keepRunning() {
+        if (!running) {
+            running = true;
+            start_time = chrono::steady_clock::now();
+        }
+        if (done_iterations < max_iterations) {
+            done_iterations++;
+            return true;
+        }
+        elapsed = chrono::steady_clock::now() - start_time;
+        return false;
+    }
+
+    void skip(const string& reason) { skip_reason = reason; }
+
+    uint64_t iterations() const { return done_iterations; }
+    double seconds() const { return chrono::duration<double>(elapsed).count(); }
+};
+
+struct BenchmarkOptions {
+    string filter;            // subsir care trebuie sa apara in nume
+    double min_time = 0.2;    // secunde per benchmark
+    bool csv = false;
+};
+
+void registerBenchmark(const string& name, function<void(BenchmarkState&)> body);
+int runBenchmarks(const BenchmarkOptions& options);
+
+// impiedica compilatorul sa elimine rezultatele calculate in bucla
+void benchmarkSink(size_t value);
+
+// contoare hardware pentru ratarile de citire din L1D si din ultimul nivel de cache
+// (perf_event_open, doar pe Linux); available() e false daca nucleul nu le expune
+class CacheMissCounters
+{
+private:
+    int l1_fd = -1;
+    int last_level_fd = -1;
+
+public:
+    CacheMissCounters();
+    ~CacheMissCounters();
+    CacheMissCounters(const CacheMissCounters&) = delete;
+    CacheMissCounters& operator=(const CacheMissCounters&) = delete;
+
+    bool available() const { return l1_fd >= 0 && last_level_fd >= 0; }
+    void start();
+    void stop();
+    uint64_t l1Misses() const;
+    uint64_t lastLevelMisses() const;
+};
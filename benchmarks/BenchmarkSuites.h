@@ -0,0 +1,20 @@
+#pragma once
+#include "DeterministicFiniteAutomaton.h"
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// cuvinte de cel mult lungimea data (~64 KB in total) obtinute prin mers aleator in AFD,
+// numai pe stari din care se mai poate ajunge intr-o stare finala
+vector<string> generateWalkWords(const DeterministicFiniteAutomaton& dfa, size_t length, unsigned seed);
+
+// octetii parcursi efectiv de un lot de cuvinte (pentru bytes_processed)
+size_t totalBytes(const vector<string>& words);
+
+// benchmark-uri care nu depind de corpusul de expresii
+void registerStateLayoutBenchmarks();
+
+// matcher-ele generate cu --emit-cpp la compilare, comparate cu checkWord pe aceleasi cuvinte
+void registerGeneratedMatcherBenchmarks(const map<string, string>& regexByName);
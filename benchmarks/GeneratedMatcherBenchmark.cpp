@@ -0,0 +1,45 @@
+#include "BenchmarkHarness.h"
+#include "BenchmarkSuites.h"
+#include "GeneratedMatchers.h"
+#include "RegexParser.h"
+#include <memory>
+
+void registerGeneratedMatcherBenchmarks(const map<string, string>& regexByName) {
+    for (const GeneratedMatcher& matcher : generatedMatchers) {
+        auto regex = regexByName.find(matcher.name);
+        if (regex == regexByName.end())
+            continue;
+
+        //acelasi AFD minimizat din care a fost generat codul, pentru cuvinte si pentru comparatie
+        auto cache = make_shared<shared_ptr<DeterministicFiniteAutomaton>>();
+        string pattern = regex->second;
+        auto dfa = [cache, pattern]() {
+            if (!*cache)
+                *cache = make_shared<DeterministicFiniteAutomaton>(RegexToDFA(pattern).minimize());
+            return *cache;
+        };
+
+        for (bool generated : { false, true }) {
+            string name = string(generated ? "BM_GeneratedMatcher/" : "BM_TableMatcher/") + matcher.name + "/4096";
+            auto match = matcher.match;
+            registerBenchmark(name, [dfa, match, generated](BenchmarkState& state) {
+                auto automaton = dfa();
+                vector<string> words = generateWalkWords(*automaton, 4096, 4096);
+
+                //verificam intai ca matcher-ul generat e de acord cu tabelul
+                for (const string& word : words)
+                    if (match(word.data(), word.size()) != automaton->checkWord(word)) {
+                        state.skip("matcher-ul generat difera de checkWord");
+                        return;
+                    }
+
+                size_t accepted = 0;
+                while (state.keepRunning())
+                    for (const string& word : words)
+                        accepted += generated ? match(word.data(), word.size()) : automaton->checkWord(word);
+                benchmarkSink(accepted);
+                state.bytes_processed = totalBytes(words);
+            });
+        }
+    }
+}
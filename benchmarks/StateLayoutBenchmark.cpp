@@ -0,0 +1,114 @@
+#include "BenchmarkHarness.h"
+#include "BenchmarkSuites.h"
+#include "DeterministicFiniteAutomaton.h"
+#include <memory>
+#include <numeric>
+#include <random>
+
+// AFD mare, generat aleator, in care ~90% din tranzitii duc intr-un subset mic de stari
+// "fierbinti" imprastiate prin numerotare; un lant i -> i + 1 pe primul simbol tine toate
+// starile accesibile, ca tabelul dens (~2 MB) sa nu incapa in L2. Comparam layout-ul tabelului dens inainte si dupa
+// renumerotarea dupa numarul de vizite, precum si tabelul dens fata de cel comprimat
+namespace {
+    const int stateCount = 1 << 16;
+    const int hotStateCount = 2048;
+    const char symbols[] = "abcdefgh";
+    const int symbolCount = 8;
+    const size_t wordLength = 4096;
+    const size_t wordCount = 16;
+
+    DeterministicFiniteAutomaton generateSkewedAutomaton() {
+        mt19937 rng(2024);
+        vector<int> hot(hotStateCount);
+        for (int& state : hot)
+            state = (int)(rng() % stateCount);
+
+        set<int> q_states, f_states;
+        map<pair<int, char>, int> delta;
+        for (int state = 0; state < stateCount; ++state) {
+            q_states.insert(state);
+            if (rng() % 2)
+                f_states.insert(state);
+            for (int c = 0; c < symbolCount; ++c) {
+                int target = rng() % 10 ? hot[rng() % hotStateCount] : (int)(rng() % stateCount);
+                if (c == 0 && state + 1 < stateCount)
+                    target = state + 1;
+                delta[{state, symbols[c]}] = target;
+            }
+        }
+
+        DeterministicFiniteAutomaton dfa;
+        dfa.setQ(q_states);
+        dfa.setSigma(set<char>(symbols, symbols + symbolCount));
+        dfa.setDelta(delta);
+        dfa.setQ0(0);
+        dfa.setF(f_states);
+        dfa.pruneDeadStates();
+        return dfa;
+    }
+
+    vector<string> generateWords(unsigned seed) {
+        mt19937 rng(seed);
+        vector<string> words(wordCount);
+        for (string& word : words)
+            for (size_t i = 0; i < wordLength; ++i)
+                word += symbols[rng() % symbolCount];
+        return words;
+    }
+
+    void registerLayout(const string& name, function<void(DeterministicFiniteAutomaton&)> layout) {
+        auto cache = make_shared<shared_ptr<DeterministicFiniteAutomaton>>();
+        registerBenchmark("BM_StateLayout/" + name, [cache, layout](BenchmarkState& state) {
+            if (!*cache) {
+                auto dfa = make_shared<DeterministicFiniteAutomaton>(generateSkewedAutomaton());
+                //altfel pruneDeadStates a taiat automatul si tabelul nu mai e "mare"
+                if (dfa->getQ().size() != (size_t)stateCount) {
+                    state.skip("AFD-ul generat are doar " + to_string(dfa->getQ().size()) + " stari utile");
+                    return;
+                }
+                layout(*dfa);
+                *cache = dfa;
+            }
+            const DeterministicFiniteAutomaton& dfa = **cache;
+            vector<string> words = generateWords(7);
+
+            CacheMissCounters misses;
+            size_t accepted = 0;
+            misses.start();
+            while (state.keepRunning())
+                for (const string& word : words)
+                    accepted += dfa.checkWord(word);
+            misses.stop();
+            benchmarkSink(accepted);
+
+            size_t bytes = words.size() * wordLength;
+            state.bytes_processed = bytes;
+            state.counters["states"] = (double)dfa.getQ().size();
+            state.counters["table_kb"] = dfa.transitionTableBytes() / 1024.0;
+            if (misses.available()) {
+                double kilobytes = (double)bytes * state.iterations() / 1024.0;
+                state.counters["l1d_miss_per_kb"] = misses.l1Misses() / kilobytes;
+                state.counters["llc_miss_per_kb"] = misses.lastLevelMisses() / kilobytes;
+            }
+        });
+    }
+}
+
+void registerStateLayoutBenchmarks() {
+    registerLayout("scattered", [](DeterministicFiniteAutomaton& dfa) {
+        vector<int> order(dfa.getQ().begin(), dfa.getQ().end());
+        shuffle(order.begin(), order.end(), mt19937(99));
+        dfa.renumberStates(order);
+    });
+    registerLayout("bfs", [](DeterministicFiniteAutomaton& dfa) {
+        dfa.reorderStatesByHotness({});
+    });
+    registerLayout("hot", [](DeterministicFiniteAutomaton& dfa) {
+        //profilul vine dintr-un esantion diferit de cuvintele masurate
+        dfa.reorderStatesByHotness(generateWords(1));
+    });
+    registerLayout("hot_compressed", [](DeterministicFiniteAutomaton& dfa) {
+        dfa.reorderStatesByHotness(generateWords(1));
+        dfa.setTransitionStorage(TransitionStorage::Compressed);
+    });
+}
@@ -0,0 +1,485 @@
+#include "DifferentialCheck.h"
+#include "BitParallelMatcher.h"
+#include "DeterministicFiniteAutomaton.h"
+#include "LazyDeterministicAutomaton.h"
+#include "MatchPlanner.h"
+#include "NondeterministicFiniteAutomaton.h"
+#include "RegexParser.h"
+#include "TaggedDeterministicAutomaton.h"
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+
+namespace {
+    const char regexOperands[] = "abc01";
+    const char wordSymbols[] = "abc01z";     // 'z' nu apare in expresii: verifica simbolurile din afara alfabetului
+    const int maxRegexDepth = 5;
+    const size_t maxWords = 8;
+    const size_t maxWordLength = 12;
+    const size_t lazyCacheStates = 4;         // cache mic ca sa fie golit des
+
+    class ByteReader {
+    private:
+        const uint8_t* data;
+        size_t size;
+        size_t position = 0;
+    public:
+        ByteReader(const uint8_t* d, size_t s) : data(d), size(s) {}
+        // dupa ultimul octet intoarce 0, deci generarea se termina cu operanzi simpli
+        uint8_t next() { return position < size ? data[position++] : 0; }
+    };
+
+    // fiecare ramura pune parantezele explicit, deci prioritatea operatorilor nu conteaza
+    string generateRegex(ByteReader& in, int depth) {
+        int choice = depth > 0 ? in.next() % 7 : 0;
+        if (choice <= 1)
+            return string(1, regexOperands[in.next() % (sizeof(regexOperands) - 1)]);
+
+        string left = generateRegex(in, depth - 1);
+        switch (choice) {
+        case 2: {
+            string right = generateRegex(in, depth - 1);
+            return left + right;
+        }
+        case 3: {
+            string right = generateRegex(in, depth - 1);
+            return "(" + left + "|" + right + ")";
+        }
+        case 4: return "(" + left + ")*";
+        case 5: return "(" + left + ")+";
+        default: return "(" + left + ")";
+        }
+    }
+
+    double millisecondsSince(chrono::steady_clock::time_point start) {
+        return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    }
+
+    FuzzFailure makeFailure(FuzzFailureKind kind, const string& engine, const string& regex,
+        const string& word, const string& detail) {
+        FuzzFailure failure;
+        failure.kind = kind;
+        failure.engine = engine;
+        failure.regex = regex;
+        failure.word = word;
+        failure.detail = detail;
+        return failure;
+    }
+
+    bool checkSubmatches(const vector<Submatch>& groups, size_t length, int groupCount, string& detail) {
+        if ((int)groups.size() != groupCount + 1 || groups[0].start != 0 || groups[0].end != (int)length) {
+            detail = "grupul 0 nu acopera tot cuvantul";
+            return false;
+        }
+        for (size_t g = 1; g < groups.size(); ++g) {
+            bool unset = groups[g].start == -1 && groups[g].end == -1;
+            bool inside = groups[g].start >= 0 && groups[g].start <= groups[g].end && groups[g].end <= (int)length;
+            if (!unset && !inside) {
+                detail = "grupul " + to_string(g) + " are pozitii invalide";
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // variante mai mici ale expresiei, cele mai mari reduceri primele: grupuri intregi sterse,
+    // paranteze desfacute, alternative sterse, apoi cate un caracter
+    vector<string> shrinkCandidates(const string& regex) {
+        vector<string> candidates;
+        vector<size_t> matching(regex.size(), string::npos);
+        vector<size_t> open;
+        for (size_t i = 0; i < regex.size(); ++i) {
+            if (regex[i] == '(')
+                open.push_back(i);
+            else if (regex[i] == ')' && !open.empty()) {
+                matching[open.back()] = i;
+                open.pop_back();
+            }
+        }
+
+        for (size_t i = 0; i < regex.size(); ++i) {
+            if (regex[i] != '(' || matching[i] == string::npos)
+                continue;
+            size_t close = matching[i];
+            size_t after = close + 1;
+            while (after < regex.size() && (regex[after] == '*' || regex[after] == '+'))
+                after++;
+            candidates.push_back(regex.substr(0, i) + regex.substr(after));
+            candidates.push_back(regex.substr(0, i) + regex.substr(i + 1, close - i - 1) + regex.substr(after));
+            if (after > close + 1)
+                candidates.push_back(regex.substr(0, close + 1) + regex.substr(after));
+        }
+
+        //o alternativa impreuna cu '|' de langa ea
+        for (size_t i = 0; i < regex.size(); ++i) {
+            if (regex[i] != '|')
+                continue;
+            size_t begin = i, end = i + 1;
+            for (int depth = 0; begin > 0; --begin) {
+                char c = regex[begin - 1];
+                if (c == ')') depth++;
+                else if (c == '(' && depth-- == 0) break;
+                else if (c == '|' && depth == 0) break;
+            }
+            for (int depth = 0; end < regex.size(); ++end) {
+                char c = regex[end];
+                if (c == '(') depth++;
+                else if (c == ')' && depth-- == 0) break;
+                else if (c == '|' && depth == 0) break;
+            }
+            candidates.push_back(regex.substr(0, begin) + regex.substr(i + 1));
+            candidates.push_back(regex.substr(0, i) + regex.substr(end));
+        }
+
+        for (size_t i = 0; i < regex.size(); ++i)
+            candidates.push_back(regex.substr(0, i) + regex.substr(i + 1));
+        return candidates;
+    }
+
+    // interpreteaza codul scris de emitCpp (etichete sN, comparatii, switch, bucla universala),
+    // ca sa comparam matcher-ul generat cu AFN-ul fara sa-l compilam
+    class EmittedMatcher {
+    private:
+        struct Label {
+            bool universal = false;
+            bool acceptAtEnd = false;
+            map<int, int> next;   // octet -> eticheta urmatoare
+        };
+        map<int, Label> labels;
+        int start = -1;
+        bool inSigma[256] = {};
+
+        static void parseCondition(const string& condition, int target, Label& label) {
+            size_t from = 0;
+            while (from <= condition.size()) {
+                size_t to = condition.find("||", from);
+                string part = condition.substr(from, to == string::npos ? string::npos : to - from);
+                int low, high;
+                if (sscanf(part.c_str(), " (c >= %d && c <= %d)", &low, &high) == 2) {
+                    for (int b = low; b <= high; ++b)
+                        label.next[b] = target;
+                }
+                else if (sscanf(part.c_str(), " c == %d", &low) == 1)
+                    label.next[low] = target;
+                if (to == string::npos)
+                    break;
+                from = to + 2;
+            }
+        }
+
+    public:
+        explicit EmittedMatcher(const string& code) {
+            istringstream in(code);
+            string line;
+            Label* current = nullptr;
+            bool readingSigma = false;
+            int sigmaIndex = 0;
+            while (getline(in, line)) {
+                int id, target;
+                if (line.find("in_sigma[256] = {") != string::npos) {
+                    readingSigma = true;
+                    continue;
+                }
+                if (readingSigma) {
+                    if (line.find("};") != string::npos) {
+                        readingSigma = false;
+                        continue;
+                    }
+                    istringstream values(line);
+                    string value;
+                    while (getline(values, value, ','))
+                        if (value.find_first_not_of(' ') != string::npos && sigmaIndex < 256)
+                            inSigma[sigmaIndex++] = stoi(value) != 0;
+                    continue;
+                }
+                if (sscanf(line.c_str(), "s%d:", &id) == 1) {
+                    current = &labels[id];
+                    continue;
+                }
+                if (!current) {
+                    if (sscanf(line.c_str(), " goto s%d;", &target) == 1)
+                        start = target;
+                    continue;
+                }
+                if (line.find("for (; p != end; ++p)") != string::npos)
+                    current->universal = true;
+                else if (line.find("if (p == end)") != string::npos) {
+                    getline(in, line);
+                    current->acceptAtEnd = line.find("return true;") != string::npos;
+                }
+                else if (line.find("if (") != string::npos && line.find(") goto s") != string::npos) {
+                    size_t open = line.find("if (") + 4, close = line.rfind(") goto s");
+                    target = stoi(line.substr(close + 8));
+                    parseCondition(line.substr(open, close - open), target, *current);
+                }
+                else if (line.find(" case ") != string::npos) {
+                    target = stoi(line.substr(line.rfind("goto s") + 6));
+                    istringstream cases(line);
+                    string token;
+                    while (cases >> token)
+                        if (token != "case" && token.back() == ':')
+                            current->next[stoi(token)] = target;
+                }
+            }
+        }
+
+        bool checkWord(const string& word) const {
+            if (start < 0)
+                return false;
+            int state = start;
+            for (size_t i = 0; ; ++i) {
+                const Label& label = labels.at(state);
+                if (label.universal) {
+                    for (; i < word.size(); ++i)
+                        if (!inSigma[(unsigned char)word[i]])
+                            return false;
+                    return true;
+                }
+                if (i == word.size())
+                    return label.acceptAtEnd;
+                auto next = label.next.find((unsigned char)word[i]);
+                if (next == label.next.end())
+                    return false;
+                state = next->second;
+            }
+        }
+    };
+
+    bool sameFailure(const FuzzFailure& a, const FuzzFailure& b) {
+        return a.kind == b.kind && a.engine == b.engine;
+    }
+}
+
+FuzzCase decodeFuzzInput(const uint8_t* data, size_t size) {
+    ByteReader in(data, size);
+    FuzzCase result;
+    result.regex = generateRegex(in, maxRegexDepth);
+
+    size_t wordCount = 1 + in.next() % maxWords;
+    for (size_t w = 0; w < wordCount; ++w) {
+        string word;
+        size_t length = in.next() % (maxWordLength + 1);
+        for (size_t i = 0; i < length; ++i)
+            word += wordSymbols[in.next() % (sizeof(wordSymbols) - 1)];
+        result.words.push_back(word);
+    }
+    return result;
+}
+
+bool runDifferentialCheck(const FuzzCase& input, const FuzzLimits& limits, FuzzFailure& failure) {
+    const string& regex = input.regex;
+    string currentEngine = "parser";
+    try {
+        string postfix = toPostfix(insertConcatenation(regex));
+        NondeterministicFiniteAutomaton nfa = regexToNFA_thompson(postfix);
+
+        Node* root = buildSyntaxTree(postfix);
+        int positions = BitParallelMatcher::countPositions(root);
+        unique_ptr<BitParallelMatcher> bitParallel;
+        if (BitParallelMatcher::fits(root))
+            bitParallel = make_unique<BitParallelMatcher>(root);
+        deleteSyntaxTree(root);
+
+        //determinizarea completa: explozia se raporteaza separat de dezacorduri
+        currentEngine = "dfa";
+        auto start = chrono::steady_clock::now();
+        DeterministicFiniteAutomaton dfa;
+        if (!nfa.tryConvertToDFA(dfa, limits.maxDfaStates)) {
+            failure = makeFailure(FuzzFailureKind::StateBlowup, "dfa", regex, "",
+                "peste " + to_string(limits.maxDfaStates) + " stari AFD");
+            return false;
+        }
+        double buildMillis = millisecondsSince(start);
+        if (buildMillis > limits.maxBuildMillis) {
+            failure = makeFailure(FuzzFailureKind::SlowBuild, "dfa", regex, "",
+                "convertToDFA a durat " + to_string((long long)buildMillis) + " ms");
+            return false;
+        }
+
+        //cu p pozitii Glushkov AFD-ul are cel mult 2^p + 1 stari
+        if (positions < 30 && dfa.getQ().size() > (1u << positions) + 1) {
+            failure = makeFailure(FuzzFailureKind::Mismatch, "dfa", regex, "",
+                to_string(dfa.getQ().size()) + " stari pentru " + to_string(positions) + " pozitii");
+            return false;
+        }
+
+        currentEngine = "min-dfa";
+        DeterministicFiniteAutomaton minimal = dfa.minimize();
+        if (minimal.getQ().size() > dfa.getQ().size()) {
+            failure = makeFailure(FuzzFailureKind::Mismatch, "min-dfa", regex, "", "AFD-ul minim are mai multe stari");
+            return false;
+        }
+        string counterexample;
+        if (!DeterministicFiniteAutomaton::equivalent(dfa, minimal, &counterexample)) {
+            failure = makeFailure(FuzzFailureKind::Mismatch, "min-dfa", regex, counterexample,
+                "equivalent() respinge AFD-ul minim");
+            return false;
+        }
+
+        //operatiile pe limbaje: incluziunea in ambele sensuri, diferenta vida si complementul
+        currentEngine = "includes";
+        if (!DeterministicFiniteAutomaton::includes(dfa, minimal, &counterexample)
+            || !DeterministicFiniteAutomaton::includes(minimal, dfa, &counterexample)) {
+            failure = makeFailure(FuzzFailureKind::Mismatch, "includes", regex, counterexample,
+                "includes() respinge AFD-ul minim");
+            return false;
+        }
+        currentEngine = "difference";
+        DeterministicFiniteAutomaton difference = dfa.differenceWith(minimal);
+        //complementul fata de tot alfabetul cuvintelor (inclusiv 'z'), ca orice cuvant sa fie in univers
+        currentEngine = "complement";
+        DeterministicFiniteAutomaton complement = dfa.complement(set<char>(wordSymbols, wordSymbols + sizeof(wordSymbols) - 1));
+        //completarea cu simboluri noi trebuie sa recalculeze tabelul si starile universale;
+        //verificam checkWord pe ambele tabele si codul generat din automatul completat
+        currentEngine = "complete";
+        DeterministicFiniteAutomaton completed = dfa.complete(set<char>(wordSymbols, wordSymbols + sizeof(wordSymbols) - 1));
+        DeterministicFiniteAutomaton completedDense = completed;
+        completedDense.setTransitionStorage(TransitionStorage::Dense);
+        ostringstream emitted;
+        completed.emitCpp(emitted, "lfc_fuzz_completed");
+        EmittedMatcher completedCode(emitted.str());
+
+        currentEngine = "dfa-compressed";
+        DeterministicFiniteAutomaton compressed = dfa;
+        compressed.setTransitionStorage(TransitionStorage::Compressed);
+
+        currentEngine = "lazy-dfa";
+        LazyDeterministicAutomaton lazy(nfa, lazyCacheStates);
+
+        currentEngine = "tagged-dfa";
+        start = chrono::steady_clock::now();
+        vector<int> groupNumbers;
+        string groupedPostfix = toPostfixWithGroups(insertConcatenation(regex), groupNumbers);
+        NondeterministicFiniteAutomaton taggedNfa = regexToNFA_thompson(groupedPostfix, groupNumbers);
+        unique_ptr<TaggedDeterministicAutomaton> tagged;
+        try {
+            //singura exceptie a constructorului pentru un AFN valid este limita de stari
+            tagged = make_unique<TaggedDeterministicAutomaton>(taggedNfa, (int)groupNumbers.size(), limits.maxDfaStates);
+        }
+        catch (const runtime_error& e) {
+            failure = makeFailure(FuzzFailureKind::StateBlowup, "tagged-dfa", regex, "", e.what());
+            return false;
+        }
+        buildMillis = millisecondsSince(start);
+        if (buildMillis > limits.maxBuildMillis) {
+            failure = makeFailure(FuzzFailureKind::SlowBuild, "tagged-dfa", regex, "",
+                "AFD-ul etichetat a durat " + to_string((long long)buildMillis) + " ms");
+            return false;
+        }
+
+        currentEngine = "planned";
+        PlannedMatcher planned(regex);
+
+        vector<pair<string, function<bool(const string&)>>> engines = {
+            { "dfa", [&](const string& w) { return dfa.checkWord(w); } },
+            { "dfa-compressed", [&](const string& w) { return compressed.checkWord(w); } },
+            { "min-dfa", [&](const string& w) { return minimal.checkWord(w); } },
+            { "lazy-dfa", [&](const string& w) { return lazy.checkWord(w); } },
+            { "tagged-dfa", [&](const string& w) { return tagged->checkWord(w); } },
+            { "planned", [&](const string& w) { return planned.checkWord(w); } },
+            { "complete", [&](const string& w) { return completed.checkWord(w); } },
+            { "complete-dense", [&](const string& w) { return completedDense.checkWord(w); } },
+            { "complete-emit-cpp", [&](const string& w) { return completedCode.checkWord(w); } },
+        };
+        if (bitParallel)
+            engines.push_back({ "bit-parallel", [&](const string& w) { return bitParallel->checkWord(w); } });
+
+        vector<Submatch> groups;
+        for (const string& word : input.words) {
+            currentEngine = "nfa";
+            bool expected = nfa.checkWord(word);
+
+            for (const auto& engine : engines) {
+                currentEngine = engine.first;
+                bool actual = engine.second(word);
+                if (actual != expected) {
+                    failure = makeFailure(FuzzFailureKind::Mismatch, engine.first, regex, word,
+                        string("AFN: ") + (expected ? "acceptat" : "respins") + ", " + engine.first + ": "
+                        + (actual ? "acceptat" : "respins"));
+                    return false;
+                }
+            }
+
+            currentEngine = "difference";
+            if (difference.checkWord(word)) {
+                failure = makeFailure(FuzzFailureKind::Mismatch, "difference", regex, word,
+                    "L(dfa) \\ L(min-dfa) accepta cuvantul");
+                return false;
+            }
+            currentEngine = "complement";
+            if (complement.checkWord(word) == expected) {
+                failure = makeFailure(FuzzFailureKind::Mismatch, "complement", regex, word,
+                    string("AFN: ") + (expected ? "acceptat" : "respins") + ", complementul la fel");
+                return false;
+            }
+
+            currentEngine = "tagged-match";
+            string detail;
+            if (tagged->match(word, groups) != expected) {
+                failure = makeFailure(FuzzFailureKind::Mismatch, "tagged-match", regex, word,
+                    "match() nu este de acord cu AFN-ul");
+                return false;
+            }
+            if (expected && !checkSubmatches(groups, word.size(), tagged->groupCount(), detail)) {
+                failure = makeFailure(FuzzFailureKind::Mismatch, "tagged-match", regex, word, detail);
+                return false;
+            }
+        }
+    }
+    catch (const exception& e) {
+        failure = makeFailure(FuzzFailureKind::Error, currentEngine, regex, "", e.what());
+        return false;
+    }
+    return true;
+}
+
+FuzzFailure minimizeFailure(const FuzzFailure& failure, const FuzzLimits& limits) {
+    FuzzFailure best = failure;
+    auto stillFails = [&](const string& regex, const string& word, FuzzFailure& result) {
+        FuzzCase candidate{ regex, { word } };
+        return !runDifferentialCheck(candidate, limits, result) && sameFailure(result, failure);
+    };
+
+    //micsoram intai expresia, apoi cuvantul (cate un caracter), cat timp problema ramane
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (const string& regex : shrinkCandidates(best.regex)) {
+            FuzzFailure result;
+            if (!regex.empty() && stillFails(regex, best.word, result)) {
+                best = result;
+                changed = true;
+                break;
+            }
+        }
+        for (size_t i = 0; !changed && i < best.word.size(); ++i) {
+            string word = best.word.substr(0, i) + best.word.substr(i + 1);
+            FuzzFailure result;
+            if (stillFails(best.regex, word, result)) {
+                best = result;
+                changed = true;
+            }
+        }
+    }
+    return best;
+}
+
+string failureKindName(FuzzFailureKind kind) {
+    switch (kind) {
+    case FuzzFailureKind::Mismatch: return "dezacord";
+    case FuzzFailureKind::StateBlowup: return "explozie de stari";
+    case FuzzFailureKind::SlowBuild: return "constructie lenta";
+    case FuzzFailureKind::Error: return "exceptie";
+    }
+    return "?";
+}
+
+void printFailure(ostream& os, const FuzzFailure& failure) {
+    os << failureKindName(failure.kind) << " [" << failure.engine << "]: " << failure.detail << endl
+        << "  expresie: " << failure.regex << endl;
+    if (failure.kind == FuzzFailureKind::Mismatch || !failure.word.empty())
+        os << "  cuvant:   \"" << failure.word << "\"" << endl;
+}
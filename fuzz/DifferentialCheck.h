@@ -0,0 +1,47 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// o expresie din gramatica suportata (operanzi, | . * + si paranteze) si cuvintele verificate
+struct FuzzCase {
+    string regex;
+    vector<string> words;
+};
+
+struct FuzzLimits {
+    size_t maxDfaStates = 20000;     // peste aceasta limita determinizarea e raportata ca explozie
+    double maxBuildMillis = 2000;    // la fel pentru timpul de constructie
+};
+
+enum class FuzzFailureKind {
+    Mismatch,      // un motor nu este de acord cu simularea AFN
+    StateBlowup,   // AFD (sau AFD etichetat) peste maxDfaStates
+    SlowBuild,     // constructia a depasit maxBuildMillis
+    Error          // exceptie neasteptata pentru o expresie valida
+};
+
+struct FuzzFailure {
+    FuzzFailureKind kind = FuzzFailureKind::Mismatch;
+    string engine;       // motorul care a dat rezultatul gresit sau a explodat
+    string regex;
+    string word;
+    string detail;
+};
+
+// transforma octetii primiti de la fuzzer intr-o expresie valida si cateva cuvinte
+FuzzCase decodeFuzzInput(const uint8_t* data, size_t size);
+
+// compara simularea AFN (move/lambdaClosure) cu toate celelalte motoare pe fiecare cuvant;
+// intoarce false si completeaza failure la prima problema gasita
+bool runDifferentialCheck(const FuzzCase& input, const FuzzLimits& limits, FuzzFailure& failure);
+
+// micsoreaza expresia si cuvantul cat timp problema (de acelasi tip, pe acelasi motor) persista
+FuzzFailure minimizeFailure(const FuzzFailure& failure, const FuzzLimits& limits);
+
+string failureKindName(FuzzFailureKind kind);
+void printFailure(ostream& os, const FuzzFailure& failure);
@@ -0,0 +1,20 @@
+#include "DifferentialCheck.h"
+#include <cstdlib>
+
+// punctul de intrare pentru libFuzzer (clang -fsanitize=fuzzer): un dezacord opreste rularea;
+// exploziile de stari/timp doar se afiseaza, sau opresc rularea daca LFC_FUZZ_FAIL_ON_BLOWUP e setat
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+    static const bool failOnBlowup = getenv("LFC_FUZZ_FAIL_ON_BLOWUP") != nullptr;
+    FuzzLimits limits;
+
+    FuzzFailure failure;
+    if (runDifferentialCheck(decodeFuzzInput(data, size), limits, failure))
+        return 0;
+
+    bool blowup = failure.kind == FuzzFailureKind::StateBlowup || failure.kind == FuzzFailureKind::SlowBuild;
+    if (blowup && !failOnBlowup)
+        return 0;
+
+    printFailure(cerr, minimizeFailure(failure, limits));
+    abort();
+}
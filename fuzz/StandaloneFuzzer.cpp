@@ -0,0 +1,97 @@
+#include "DifferentialCheck.h"
+#include <fstream>
+#include <iterator>
+#include <random>
+
+// rulare fara libFuzzer: intrari aleatoare (sau fisierele date, ex. un crash salvat de libFuzzer)
+// trecute prin aceeasi verificare diferentiala; cazurile gasite sunt minimizate inainte de afisare
+namespace {
+    struct FuzzerOptions {
+        size_t runs = 10000;
+        unsigned seed = 1;
+        size_t maxInputBytes = 64;
+        bool failOnBlowup = false;
+        vector<string> files;
+    };
+
+    void printUsage(const string& program) {
+        cout << "Utilizare: " << program << " [--runs N] [--seed S] [--max-len N] [--max-states N]"
+            << " [--max-build-ms N] [--fail-on-blowup] [FISIER...]" << endl;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    FuzzerOptions options;
+    FuzzLimits limits;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--runs" && hasValue)
+            options.runs = stoul(argv[++i]);
+        else if (arg == "--seed" && hasValue)
+            options.seed = (unsigned)stoul(argv[++i]);
+        else if (arg == "--max-len" && hasValue)
+            options.maxInputBytes = stoul(argv[++i]);
+        else if (arg == "--max-states" && hasValue)
+            limits.maxDfaStates = stoul(argv[++i]);
+        else if (arg == "--max-build-ms" && hasValue)
+            limits.maxBuildMillis = stod(argv[++i]);
+        else if (arg == "--fail-on-blowup")
+            options.failOnBlowup = true;
+        else if (arg == "-h" || arg == "--help") {
+            printUsage(argv[0]);
+            return 0;
+        }
+        else if (!arg.empty() && arg[0] == '-') {
+            printUsage(argv[0]);
+            return 2;
+        }
+        else
+            options.files.push_back(arg);
+    }
+
+    vector<vector<uint8_t>> inputs;
+    for (const string& path : options.files) {
+        ifstream in(path, ios::binary);
+        if (!in.is_open()) {
+            cerr << "Eroare: Nu s-a putut deschide fisierul " << path << endl;
+            return 2;
+        }
+        inputs.emplace_back(istreambuf_iterator<char>(in), istreambuf_iterator<char>());
+    }
+
+    mt19937 rng(options.seed);
+    size_t total = options.files.empty() ? options.runs : inputs.size();
+    size_t mismatches = 0, blowups = 0;
+    for (size_t run = 0; run < total; ++run) {
+        vector<uint8_t> bytes;
+        if (options.files.empty()) {
+            bytes.resize(rng() % (options.maxInputBytes + 1));
+            for (uint8_t& byte : bytes)
+                byte = (uint8_t)rng();
+        }
+        else
+            bytes = inputs[run];
+
+        FuzzFailure failure;
+        if (runDifferentialCheck(decodeFuzzInput(bytes.data(), bytes.size()), limits, failure))
+            continue;
+
+        bool blowup = failure.kind == FuzzFailureKind::StateBlowup || failure.kind == FuzzFailureKind::SlowBuild;
+        if (blowup)
+            blowups++;
+        else
+            mismatches++;
+
+        //primele cazuri din fiecare categorie sunt minimizate si afisate
+        if ((blowup ? blowups : mismatches) <= 3) {
+            cout << "rularea " << run << ": ";
+            printFailure(cout, minimizeFailure(failure, limits));
+        }
+    }
+
+    cout << total << " intrari, " << mismatches << " dezacorduri, " << blowups << " explozii" << endl;
+    if (mismatches > 0 || (options.failOnBlowup && blowups > 0))
+        return 1;
+    return 0;
+}
@@ -0,0 +1,114 @@
+#include "BitParallelMatcher.h"
+#include <stdexcept>
+#include <vector>
+
+namespace {
+    struct GlushkovSets {
+        bool nullable;
+        uint64_t first;
+        uint64_t last;
+    };
+
+    // First/Last/nullable pentru fiecare subarbore; follow[p] primeste pozitiile care pot urma dupa p
+    GlushkovSets glushkov(const Node* node, int& nextPosition, vector<uint64_t>& follow, uint64_t symbolMask[256]) {
+        if (!node->left && !node->right) {
+            if (!isOperand(node->value))
+                throw runtime_error(string("BitParallelMatcher: frunza invalida '") + node->value + "'.");
+            int position = nextPosition++;
+            uint64_t bit = 1ULL << position;
+            symbolMask[(unsigned char)node->value] |= bit;
+            return { false, bit, bit };
+        }
+
+        auto addFollow = [&follow](uint64_t from, uint64_t to) {
+            for (int p = 0; p < 64; ++p)
+                if (from >> p & 1)
+                    follow[p] |= to;
+        };
+
+        //orice alt operator ar schimba limbajul fata de celelalte motoare (de ex. tratat ca concatenare)
+        bool unary = isUnaryOperator(node->value) && node->left && !node->right;
+        bool binary = (node->value == '.' || node->value == '|') && node->left && node->right;
+        if (!unary && !binary)
+            throw runtime_error(string("BitParallelMatcher: operator necunoscut '") + node->value + "'.");
+
+        GlushkovSets a = glushkov(node->left, nextPosition, follow, symbolMask);
+        if (unary) {
+            //a* si a+: dupa o pozitie finala a lui a poate reincepe a
+            addFollow(a.last, a.first);
+            return { node->value == '*' || a.nullable, a.first, a.last };
+        }
+
+        GlushkovSets b = glushkov(node->right, nextPosition, follow, symbolMask);
+        if (node->value == '|')
+            return { a.nullable || b.nullable, a.first | b.first, a.last | b.last };
+
+        // concatenare
+        addFollow(a.last, b.first);
+        return {
+            a.nullable && b.nullable,
+            a.nullable ? a.first | b.first : a.first,
+            b.nullable ? a.last | b.last : b.last
+        };
+    }
+}
+
+int BitParallelMatcher::countPositions(const Node* root) {
+    if (!root)
+        return 0;
+    if (!root->left && !root->right)
+        return 1;
+    return countPositions(root->left) + countPositions(root->right);
+}
+
+bool BitParallelMatcher::fits(const Node* root) {
+    int positions = countPositions(root);
+    return positions > 0 && positions <= maxPositions;
+}
+
+BitParallelMatcher::BitParallelMatcher(const Node* root) {
+    if (!root)
+        throw runtime_error("BitParallelMatcher: arbore sintactic gol.");
+    position_count = countPositions(root);
+    if (position_count > maxPositions)
+        throw runtime_error("BitParallelMatcher: expresia are prea multe pozitii pentru 64 de biti.");
+
+    for (uint64_t& mask : symbol_mask)
+        mask = 0;
+    vector<uint64_t> follow(64, 0);
+    int nextPosition = 1;
+    GlushkovSets sets = glushkov(root, nextPosition, follow, symbol_mask);
+
+    //din starea initiala se ajunge in First
+    follow[0] = sets.first;
+    final_mask = sets.last | (sets.nullable ? 1ULL : 0);
+
+    //tabelele pe octeti: follow_table[k][v] = reuniunea Follow(p) pentru bitii din v, p = 8k + bit
+    chunk_count = (position_count + 1 + 7) / 8;
+    for (int k = 0; k < 8; ++k)
+        for (int v = 0; v < 256; ++v) {
+            uint64_t reachable = 0;
+            if (k < chunk_count)
+                for (int bit = 0; bit < 8; ++bit)
+                    if (v >> bit & 1)
+                        reachable |= follow[8 * k + bit];
+            follow_table[k][v] = reachable;
+        }
+}
+
+bool BitParallelMatcher::checkWord(const string& word) const {
+    uint64_t active = 1;
+    for (char symbol : word) {
+        uint64_t reachable = 0;
+        for (int k = 0; k < chunk_count; ++k)
+            reachable |= follow_table[k][(active >> (8 * k)) & 0xFF];
+        active = reachable & symbol_mask[(unsigned char)symbol];
+        if (!active)
+            return false;
+    }
+    return (active & final_mask) != 0;
+}
+
+int BitParallelMatcher::positions() const {
+    return position_count;
+}
@@ -0,0 +1,31 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include "RegexParser.h"
+
+using namespace std;
+
+// Automat Glushkov simulat bit-paralel (Shift-And generalizat): fiecare frunza din arborele
+// sintactic este o pozitie, iar multimea pozitiilor active incape intr-un singur uint64_t.
+// Bitul 0 este starea initiala, deci expresia poate avea cel mult 63 de operanzi.
+class BitParallelMatcher
+{
+private:
+    uint64_t symbol_mask[256];          // B[c] - pozitiile etichetate cu simbolul c
+    uint64_t follow_table[8][256];      // reuniunea Follow pentru fiecare valoare a fiecarui octet din D
+    uint64_t final_mask;                // Last, plus starea initiala daca expresia accepta lambda
+    int position_count;
+    int chunk_count;                    // cati octeti din D sunt folositi
+
+public:
+    static constexpr int maxPositions = 63;
+
+    static int countPositions(const Node* root);
+    static bool fits(const Node* root);
+
+    // arunca runtime_error daca arborele e gol sau are prea multe pozitii
+    explicit BitParallelMatcher(const Node* root);
+
+    bool checkWord(const string& word) const;
+    int positions() const;
+};
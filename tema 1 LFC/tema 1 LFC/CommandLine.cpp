@@ -0,0 +1,352 @@
+﻿#include "CommandLine.h"
+#include "DeterministicFiniteAutomaton.h"
+#include "MatchPlanner.h"
+#include "RegexParser.h"
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+
+namespace {
+    const size_t outputFlushLimit = 1 << 16;
+
+    bool readRegexFile(const string& path, string& regex) {
+        ifstream in(path);
+        if (!in.is_open())
+            return false;
+        getline(in, regex);
+        if (!regex.empty() && regex.back() == '\r')
+            regex.pop_back();
+        return true;
+    }
+
+    // iesire bufferizata: scriem in blocuri mari in loc de o scriere pe linie
+    class OutputBuffer {
+    private:
+        string buffer;
+    public:
+        ~OutputBuffer() { flush(); }
+        void append(const string& text) {
+            buffer += text;
+            if (buffer.size() >= outputFlushLimit)
+                flush();
+        }
+        void appendLine(const string& prefix, const string& line) {
+            buffer += prefix;
+            buffer += line;
+            buffer += '\n';
+            if (buffer.size() >= outputFlushLimit)
+                flush();
+        }
+        void flush() {
+            if (!buffer.empty())
+                fwrite(buffer.data(), 1, buffer.size(), stdout);
+            buffer.clear();
+        }
+    };
+
+    // volumul asteptat pentru planificator: marimea fisierelor, sau o valoare implicita pentru stdin
+    size_t expectedInputBytes(const vector<string>& inputs) {
+        size_t total = 0;
+        for (const string& input : inputs) {
+            ifstream in(input, ios::binary | ios::ate);
+            if (input == "-" || !in.is_open())
+                total += PlannerOptions().expectedInputBytes;
+            else
+                total += (size_t)in.tellg();
+        }
+        return inputs.empty() ? PlannerOptions().expectedInputBytes : total;
+    }
+
+    // --groups: linia acceptata urmata de subpotrivirea fiecarui grup, separate prin tab
+    size_t scanStreamWithGroups(istream& in, const string& prefix, const TaggedDeterministicAutomaton& tagged,
+        OutputMode mode, OutputBuffer& out) {
+        size_t selected = 0;
+        string line, text;
+        vector<Submatch> groups;
+        while (getline(in, line)) {
+            if (!line.empty() && line.back() == '\r')
+                line.pop_back();
+            if (!tagged.match(line, groups))
+                continue;
+            selected++;
+            if (mode != OutputMode::PrintMatching)
+                continue;
+            text = line;
+            for (size_t g = 1; g < groups.size(); ++g) {
+                text += '\t' + to_string(g) + ':';
+                if (groups[g].start < 0)
+                    text += '-';
+                else
+                    text.append(line, groups[g].start, groups[g].end - groups[g].start);
+            }
+            out.appendLine(prefix, text);
+        }
+        return selected;
+    }
+
+    template <typename Matcher>
+    size_t scanStream(istream& in, const string& prefix, const Matcher& matcher,
+        const CommandLineOptions& options, OutputBuffer& out) {
+        size_t selected = 0;
+        string line;
+        while (getline(in, line)) {
+            if (!line.empty() && line.back() == '\r')
+                line.pop_back();
+            if (matcher.checkWord(line) == options.invert)
+                continue;
+            selected++;
+            if (options.mode == OutputMode::PrintMatching)
+                out.appendLine(prefix, line);
+        }
+        return selected;
+    }
+}
+
+bool parseCommandLine(int argc, char* argv[], CommandLineOptions& options, string& error) {
+    if (argc <= 1) {
+        options.interactive = true;
+        return true;
+    }
+
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        bool needsValue = arg == "-e" || arg == "--regexp" || arg == "-f" || arg == "--file"
+            || arg == "--and" || arg == "--and-not" || arg == "--equivalent"
+            || arg == "--emit-cpp" || arg == "-o" || arg == "--output" || arg == "--engine";
+        if (needsValue && i + 1 >= argc) {
+            error = "Optiunea " + arg + " necesita o valoare.";
+            return false;
+        }
+
+        if (arg == "-e" || arg == "--regexp") {
+            options.regex = argv[++i];
+            options.regexGiven = true;
+        }
+        else if (arg == "-f" || arg == "--file") {
+            string path = argv[++i];
+            if (!readRegexFile(path, options.regex)) {
+                error = "Nu s-a putut citi expresia din " + path + ".";
+                return false;
+            }
+            options.regexGiven = true;
+        }
+        else if (arg == "--and")
+            options.andRegexes.push_back(argv[++i]);
+        else if (arg == "--and-not")
+            options.andNotRegexes.push_back(argv[++i]);
+        else if (arg == "--equivalent") {
+            options.equivalentRegex = argv[++i];
+            options.checkEquivalence = true;
+        }
+        else if (arg == "--emit-cpp")
+            options.emitFunction = argv[++i];
+        else if (arg == "-o" || arg == "--output")
+            options.outputPath = argv[++i];
+        else if (arg == "--engine") {
+            options.engine = argv[++i];
+            MatchEngine engine;
+            if (options.engine != "auto" && !parseEngineName(options.engine, engine)) {
+                error = "Motor necunoscut: " + options.engine
+                    + " (auto, dfa, min-dfa, lazy-dfa, nfa, bit-parallel).";
+                return false;
+            }
+        }
+        else if (arg == "--plan")
+            options.showPlan = true;
+        else if (arg == "--groups")
+            options.showGroups = true;
+        else if (arg == "-c" || arg == "--count")
+            options.mode = OutputMode::Count;
+        else if (arg == "-v" || arg == "--invert-match")
+            options.invert = true;
+        else if (arg == "-i" || arg == "--interactive")
+            options.interactive = true;
+        else if (arg == "-h" || arg == "--help")
+            options.showHelp = true;
+        else if (arg.size() > 1 && arg[0] == '-') {
+            error = "Optiune necunoscuta: " + arg;
+            return false;
+        }
+        else
+            options.inputs.push_back(arg);
+    }
+
+    //fara -e/-f primul argument pozitional este expresia (ca la grep)
+    if (!options.regexGiven && !options.interactive && !options.showHelp) {
+        if (options.inputs.empty()) {
+            error = "Lipseste expresia regulata.";
+            return false;
+        }
+        options.regex = options.inputs.front();
+        options.inputs.erase(options.inputs.begin());
+        options.regexGiven = true;
+    }
+    return true;
+}
+
+void printUsage(ostream& os, const string& program) {
+    os << "Utilizare: " << program << " [optiuni] EXPRESIE [FISIER...]" << endl
+        << "       " << program << " [optiuni] -e EXPRESIE | -f FISIER_EXPRESIE [FISIER...]" << endl
+        << "       " << program << " -i [-e EXPRESIE]   (meniul interactiv)" << endl
+        << "Fiecare linie din FISIER (sau stdin) este verificata integral cu expresia." << endl
+        << "  -e, --regexp EXPR     expresia regulata" << endl
+        << "  -f, --file CALE       citeste expresia din prima linie a fisierului" << endl
+        << "      --and EXPR        linia trebuie acceptata si de EXPR (se poate repeta)" << endl
+        << "      --and-not EXPR    linia nu trebuie acceptata de EXPR (se poate repeta)" << endl
+        << "      --equivalent EXPR verifica daca EXPR accepta acelasi limbaj" << endl
+        << "      --emit-cpp NUME   genereaza functia C++ NUME(const char*, size_t) din AFD" << endl
+        << "  -o, --output CALE     fisierul pentru codul generat (implicit stdout)" << endl
+        << "      --engine NUME     auto (implicit), dfa, min-dfa, lazy-dfa, nfa sau bit-parallel" << endl
+        << "      --plan            afiseaza la stderr motorul ales si costul estimat" << endl
+        << "      --groups          afiseaza dupa fiecare linie grupurile: <nr>:<text>, <nr>:- daca lipseste" << endl
+        << "  -c, --count           afiseaza doar numarul de linii selectate" << endl
+        << "  -v, --invert-match    selecteaza liniile respinse" << endl
+        << "  -i, --interactive     porneste meniul interactiv" << endl
+        << "  -h, --help            afiseaza acest mesaj" << endl;
+}
+
+int runBatch(const CommandLineOptions& options) {
+    ios::sync_with_stdio(false);
+
+    //filtrele compuse devin un singur AFD produs, parcurs o singura data pe fiecare linie;
+    //o expresie simpla trece prin planificator, care alege motorul dupa AFN si volumul intrarii
+    bool composed = !options.andRegexes.empty() || !options.andNotRegexes.empty();
+    if (composed && options.engine != "auto") {
+        cerr << "Eroare: --engine nu se poate folosi impreuna cu --and/--and-not." << endl;
+        return 2;
+    }
+
+    if (options.showGroups && (composed || options.invert || options.engine != "auto")) {
+        cerr << "Eroare: --groups nu se poate folosi cu --and/--and-not, -v sau --engine." << endl;
+        return 2;
+    }
+
+    DeterministicFiniteAutomaton dfa;
+    unique_ptr<PlannedMatcher> planned;
+    unique_ptr<TaggedDeterministicAutomaton> tagged;
+    try {
+        if (options.showGroups) {
+            tagged = make_unique<TaggedDeterministicAutomaton>(RegexToTaggedDFA(options.regex));
+            if (options.showPlan)
+                cerr << "Motor: tagged-dfa (" << tagged->stateCount() << " stari, "
+                    << tagged->groupCount() << " grupuri)" << endl;
+        }
+        else if (!composed) {
+            PlannerOptions plannerOptions;
+            plannerOptions.expectedInputBytes = expectedInputBytes(options.inputs);
+            if (options.engine != "auto") {
+                plannerOptions.forceEngine = true;
+                parseEngineName(options.engine, plannerOptions.forcedEngine);
+            }
+            planned = make_unique<PlannedMatcher>(options.regex, plannerOptions);
+            if (options.showPlan)
+                planned->getPlan().print(cerr);
+        }
+        else {
+            dfa = RegexToDFA(options.regex);
+            for (const string& regex : options.andRegexes)
+                dfa = dfa.intersectWith(RegexToDFA(regex));
+            for (const string& regex : options.andNotRegexes)
+                dfa = dfa.differenceWith(RegexToDFA(regex));
+            dfa = dfa.minimize();
+            if (options.showPlan)
+                cerr << "Motor: min-dfa (filtru compus, AFD produs cu " << dfa.getQ().size() << " stari)" << endl;
+        }
+    }
+    catch (const exception& e) {
+        cerr << "Eroare: " << e.what() << endl;
+        return 2;
+    }
+
+    auto scan = [&](istream& in, const string& prefix, OutputBuffer& out) {
+        if (tagged)
+            return scanStreamWithGroups(in, prefix, *tagged, options.mode, out);
+        return planned ? scanStream(in, prefix, *planned, options, out)
+            : scanStream(in, prefix, dfa, options, out);
+    };
+
+    vector<string> inputs = options.inputs;
+    if (inputs.empty())
+        inputs.push_back("-");
+    bool showNames = inputs.size() > 1;
+
+    OutputBuffer out;
+    size_t totalSelected = 0;
+    bool failed = false;
+
+    for (const string& input : inputs) {
+        string name = input == "-" ? "(stdin)" : input;
+        string prefix = showNames ? name + ":" : "";
+        size_t selected;
+
+        if (input == "-")
+            selected = scan(cin, prefix, out);
+        else {
+            ifstream in(input);
+            if (!in.is_open()) {
+                out.flush();
+                cerr << "Eroare: Nu s-a putut deschide fisierul " << input << endl;
+                failed = true;
+                continue;
+            }
+            selected = scan(in, prefix, out);
+        }
+
+        if (options.mode == OutputMode::Count)
+            out.append(prefix + to_string(selected) + "\n");
+        totalSelected += selected;
+    }
+    out.flush();
+
+    if (failed)
+        return 2;
+    return totalSelected > 0 ? 0 : 1;
+}
+
+int runEquivalenceCheck(const CommandLineOptions& options) {
+    DeterministicFiniteAutomaton first, second;
+    try {
+        first = RegexToDFA(options.regex);
+        second = RegexToDFA(options.equivalentRegex);
+    }
+    catch (const exception& e) {
+        cerr << "Eroare: " << e.what() << endl;
+        return 2;
+    }
+
+    string counterexample;
+    if (DeterministicFiniteAutomaton::equivalent(first, second, &counterexample)) {
+        cout << "Expresiile sunt echivalente." << endl;
+        return 0;
+    }
+
+    string acceptedBy = first.checkWord(counterexample) ? options.regex : options.equivalentRegex;
+    cout << "Expresiile difera. Contraexemplu: \"" << counterexample << "\" (acceptat doar de "
+        << acceptedBy << ")" << endl;
+    return 1;
+}
+
+int runCodeGeneration(const CommandLineOptions& options) {
+    DeterministicFiniteAutomaton dfa;
+    try {
+        dfa = RegexToDFA(options.regex).minimize();
+    }
+    catch (const exception& e) {
+        cerr << "Eroare: " << e.what() << endl;
+        return 2;
+    }
+
+    if (options.outputPath.empty()) {
+        dfa.emitCpp(cout, options.emitFunction);
+        return 0;
+    }
+
+    ofstream outFile(options.outputPath);
+    if (!outFile.is_open()) {
+        cerr << "Eroare: Nu s-a putut deschide fisierul " << options.outputPath << endl;
+        return 2;
+    }
+    dfa.emitCpp(outFile, options.emitFunction);
+    return 0;
+}
@@ -0,0 +1,44 @@
+#pragma once
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+enum class OutputMode {
+    PrintMatching,   // afiseaza liniile acceptate (implicit)
+    Count            // -c: doar numarul de linii acceptate
+};
+
+struct CommandLineOptions {
+    string regex;
+    bool regexGiven = false;
+    bool interactive = false;      // meniul clasic (implicit cand nu exista argumente)
+    bool invert = false;           // -v: selecteaza liniile respinse
+    bool showHelp = false;
+    OutputMode mode = OutputMode::PrintMatching;
+    vector<string> inputs;         // fisiere de intrare, "-" sau nimic = stdin
+    vector<string> andRegexes;     // --and: linia trebuie acceptata si de aceste expresii
+    vector<string> andNotRegexes;  // --and-not: linia nu trebuie acceptata de aceste expresii
+    string equivalentRegex;        // --equivalent: compara limbajele in loc sa filtreze
+    bool checkEquivalence = false;
+    string emitFunction;           // --emit-cpp: numele functiei C++ generate din AFD
+    string outputPath;             // -o: fisierul pentru codul generat (implicit stdout)
+    string engine = "auto";        // --engine: motorul de potrivire (auto = ales de planificator)
+    bool showPlan = false;         // --plan: afiseaza planul ales la stderr
+    bool showGroups = false;       // --groups: afiseaza si subpotrivirile grupurilor (AFD etichetat)
+};
+
+// intoarce false si completeaza error daca argumentele sunt invalide
+bool parseCommandLine(int argc, char* argv[], CommandLineOptions& options, string& error);
+void printUsage(ostream& os, const string& program);
+
+// modul neinteractiv: fiecare linie din intrare este un cuvant verificat cu motorul ales de planificator
+// cod de iesire ca la grep: 0 - cel putin o linie selectata, 1 - niciuna, 2 - eroare
+int runBatch(const CommandLineOptions& options);
+
+// --equivalent: 0 daca expresiile accepta acelasi limbaj, 1 daca nu (cu contraexemplu), 2 - eroare
+int runEquivalenceCheck(const CommandLineOptions& options);
+
+// --emit-cpp: scrie AFD-ul minimizat ca functie C++ cu cod direct
+int runCodeGeneration(const CommandLineOptions& options);
@@ -1,19 +1,125 @@
 ﻿#include "DeterministicFiniteAutomaton.h"
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <queue>
+
+namespace {
+    // AFD cu stari indexate 0..n-1 si tabel de tranzitii dens pe un alfabet dat;
+    // indicele n este starea moarta implicita
+    struct IndexedAutomaton {
+        int dead;
+        int start;
+        size_t width;
+        vector<int> table;
+        vector<bool> accepting;
+
+        IndexedAutomaton(const DeterministicFiniteAutomaton& dfa, const vector<char>& alphabet) {
+            vector<int> states(dfa.getQ().begin(), dfa.getQ().end());
+            map<int, int> index;
+            for (int i = 0; i < (int)states.size(); ++i)
+                index[states[i]] = i;
+
+            dead = (int)states.size();
+            width = alphabet.size();
+            table.assign((states.size() + 1) * width, dead);
+            accepting.assign(states.size() + 1, false);
+            for (int i = 0; i < dead; ++i) {
+                accepting[i] = dfa.getF().count(states[i]) > 0;
+                for (size_t c = 0; c < width; ++c) {
+                    auto it = dfa.getDelta().find({ states[i], alphabet[c] });
+                    if (it != dfa.getDelta().end())
+                        table[i * width + c] = index.at(it->second);
+                }
+            }
+            auto it = index.find(dfa.getQ0());
+            start = it == index.end() ? dead : it->second;
+        }
+
+        int next(int state, size_t symbol) const { return table[state * width + symbol]; }
+    };
+
+    vector<char> sharedAlphabet(const DeterministicFiniteAutomaton& a, const DeterministicFiniteAutomaton& b) {
+        set<char> alphabet = a.getSigma();
+        alphabet.insert(b.getSigma().begin(), b.getSigma().end());
+        return vector<char>(alphabet.begin(), alphabet.end());
+    }
+
+    // BFS pe produs: primul cuvant (cel mai scurt) care duce intr-o pereche cu isWitness adevarat
+    bool shortestWitness(const DeterministicFiniteAutomaton& a, const DeterministicFiniteAutomaton& b,
+        const function<bool(bool, bool)>& isWitness, string* witness) {
+        vector<char> alphabet = sharedAlphabet(a, b);
+        IndexedAutomaton A(a, alphabet), B(b, alphabet);
+
+        //doar perechile atinse sunt memorate: parinte si simbolul prin care s-a ajuns
+        map<pair<int, int>, pair<pair<int, int>, char>> parent;
+        queue<pair<int, int>> pairs_to_process;
+        pair<int, int> start = { A.start, B.start };
+        parent[start] = { start, 0 };
+        pairs_to_process.push(start);
+
+        while (!pairs_to_process.empty()) {
+            pair<int, int> current = pairs_to_process.front();
+            pairs_to_process.pop();
+            auto [p, q] = current;
+
+            if (isWitness(A.accepting[p], B.accepting[q])) {
+                if (witness) {
+                    string word;
+                    for (pair<int, int> node = current; node != start; node = parent.at(node).first)
+                        word += parent.at(node).second;
+                    witness->assign(word.rbegin(), word.rend());
+                }
+                return true;
+            }
+            if (p == A.dead && q == B.dead)
+                continue;
+
+            for (size_t c = 0; c < alphabet.size(); ++c) {
+                pair<int, int> target = { A.next(p, c), B.next(q, c) };
+                if (parent.emplace(target, make_pair(current, alphabet[c])).second)
+                    pairs_to_process.push(target);
+            }
+        }
+        return false;
+    }
+}
 
 void DeterministicFiniteAutomaton:: setQ(const set<int>& Q){ 
 	Q_states = Q; 
+	invalidateTransitionTable();
 }
 void DeterministicFiniteAutomaton::setSigma(const set<char>& Sigma) { 
 	Sigma_alphabet = Sigma; 
+	invalidateTransitionTable();
 }
 void DeterministicFiniteAutomaton:: setDelta(const map<pair<int, char>, int>& delta) { 
 	delta_transition = delta; 
+	invalidateTransitionTable();
 }
 void DeterministicFiniteAutomaton::setQ0(int q0) { 
 	q0_initialState = q0;
+	invalidateTransitionTable();
 }
 void DeterministicFiniteAutomaton::setF(const set<int>& F) { 
 	F_finalStates = F; 
+	invalidateTransitionTable();
+}
+
+const set<int>& DeterministicFiniteAutomaton::getQ() const {
+    return Q_states;
+}
+const set<char>& DeterministicFiniteAutomaton::getSigma() const {
+    return Sigma_alphabet;
+}
+const map<pair<int, char>, int>& DeterministicFiniteAutomaton::getDelta() const {
+    return delta_transition;
+}
+int DeterministicFiniteAutomaton::getQ0() const {
+    return q0_initialState;
+}
+const set<int>& DeterministicFiniteAutomaton::getF() const {
+    return F_finalStates;
 }
 
 
@@ -108,21 +214,951 @@ void DeterministicFiniteAutomaton::printAutomaton(ostream& os) const {
     os << "---------------------------------------" << endl;
 }
 
+namespace {
+    // octetii dati, grupati in intervale consecutive
+    vector<pair<int, int>> byteRanges(vector<int> bytes) {
+        sort(bytes.begin(), bytes.end());
+        vector<pair<int, int>> ranges;
+        for (int b : bytes) {
+            if (!ranges.empty() && ranges.back().second + 1 == b)
+                ranges.back().second = b;
+            else
+                ranges.push_back({ b, b });
+        }
+        return ranges;
+    }
+
+    string rangeCondition(const vector<pair<int, int>>& ranges) {
+        string condition;
+        for (const auto& range : ranges) {
+            if (!condition.empty())
+                condition += " || ";
+            if (range.first == range.second)
+                condition += "c == " + to_string(range.first);
+            else
+                condition += "(c >= " + to_string(range.first) + " && c <= " + to_string(range.second) + ")";
+        }
+        return condition.empty() ? "false" : condition;
+    }
+}
+
+void DeterministicFiniteAutomaton::emitCpp(ostream& os, const string& functionName) const {
+    //peste atatea intervale pe stare folosim switch in loc de comparatii
+    const size_t maxComparisonRanges = 6;
+
+    //apartenenta la Sigma in starile universale: tabel de 256 octeti, fara ramificari pe intrare
+    bool inSigma[256] = {};
+    for (char symbol : Sigma_alphabet)
+        inSigma[(unsigned char)symbol] = true;
+
+    os << "// Generat de DeterministicFiniteAutomaton::emitCpp (" << Q_states.size()
+        << " stari, " << Sigma_alphabet.size() << " simboluri). Nu editati manual." << endl;
+    os << "#include <cstddef>" << endl << endl;
+    os << "bool " << functionName << "(const char* data, std::size_t length)" << endl;
+    os << "{" << endl;
+    os << "    const unsigned char* p = reinterpret_cast<const unsigned char*>(data);" << endl;
+    os << "    const unsigned char* end = p + length;" << endl;
+    os << "    unsigned c;" << endl;
+    if (Q_states.find(q0_initialState) == Q_states.end()) {
+        os << "    (void)p; (void)end; (void)c;" << endl;
+        os << "    return false;" << endl << "}" << endl;
+        return;
+    }
+    if (!universal_states.empty()) {
+        os << "    static const unsigned char in_sigma[256] = {";
+        for (int b = 0; b < 256; ++b)
+            os << (b % 32 ? " " : "\n        ") << inSigma[b] << (b < 255 ? "," : "");
+        os << endl << "    };" << endl;
+    }
+    //daca toate starile sunt universale, nicio stare nu citeste in c
+    bool readsSymbols = false;
+    for (int state : Q_states)
+        readsSymbols = readsSymbols || !universal_states.count(state);
+    if (!readsSymbols)
+        os << "    (void)c;" << endl;
+    os << "    goto s" << q0_initialState << ";" << endl;
+
+    for (int currentState : Q_states) {
+        os << endl << "s" << currentState << ":" << endl;
+
+        if (universal_states.count(currentState)) {
+            //orice continuare peste Sigma e acceptata
+            os << "    for (; p != end; ++p)" << endl;
+            os << "        if (!in_sigma[*p])" << endl;
+            os << "            return false;" << endl;
+            os << "    return true;" << endl;
+            continue;
+        }
+
+        os << "    if (p == end)" << endl;
+        os << "        return " << (F_finalStates.count(currentState) ? "true" : "false") << ";" << endl;
+        os << "    c = *p++;" << endl;
+
+        //simbolurile grupate dupa starea urmatoare
+        map<int, vector<int>> bytesByTarget;
+        for (char symbol : Sigma_alphabet) {
+            auto it = delta_transition.find({ currentState, symbol });
+            if (it != delta_transition.end())
+                bytesByTarget[it->second].push_back((unsigned char)symbol);
+        }
+
+        size_t rangeCount = 0;
+        map<int, vector<pair<int, int>>> rangesByTarget;
+        for (const auto& entry : bytesByTarget) {
+            rangesByTarget[entry.first] = byteRanges(entry.second);
+            rangeCount += rangesByTarget[entry.first].size();
+        }
+
+        if (rangeCount <= maxComparisonRanges) {
+            for (const auto& entry : rangesByTarget)
+                os << "    if (" << rangeCondition(entry.second) << ") goto s" << entry.first << ";" << endl;
+            os << "    return false;" << endl;
+            continue;
+        }
+
+        os << "    switch (c) {" << endl;
+        for (const auto& entry : bytesByTarget) {
+            os << "   ";
+            for (int b : entry.second)
+                os << " case " << b << ":";
+            os << " goto s" << entry.first << ";" << endl;
+        }
+        os << "    default: return false;" << endl;
+        os << "    }" << endl;
+    }
+    os << "}" << endl;
+}
+
+template <typename NextRow>
+bool DeterministicFiniteAutomaton::scanTable(const string& word, NextRow nextRow) const {
+    int row = table_start;
+    for (size_t i = 0; i < word.size(); ++i) {
+        if (row_flags[row] & ROW_UNIVERSAL) {
+            for (size_t j = i; j < word.size(); ++j)
+                if (symbol_column[(unsigned char)word[j]] < 0)
+                    return false;
+            return true;
+        }
+        int column = symbol_column[(unsigned char)word[i]];
+        if (column < 0)
+            return false;
+        row = nextRow(row, column);
+        if (row < 0)
+            return false;
+    }
+    return (row_flags[row] & ROW_FINAL) != 0;
+}
+
 bool DeterministicFiniteAutomaton:: checkWord(const string& word) const {
+    if (active_storage == TransitionStorage::Dense) {
+        const int* table = dense_table.data();
+        size_t width = table_width;
+        return scanTable(word, [table, width](int row, int column) { return table[row * width + column]; });
+    }
+    if (active_storage == TransitionStorage::Compressed)
+        return scanTable(word, [this](int row, int column) { return compressedNext(row, column); });
+
     int currentState = q0_initialState;
-    for (char symbol : word) {
-        auto key = make_pair(currentState, symbol);
-        // Verifica dacă exista o tranzitie pentru simbolul curent
-        if (delta_transition.count(key)) {
-            currentState = delta_transition.at(key);
+    bool earlyAccept = !universal_states.empty();
+    for (size_t i = 0; i < word.size(); ++i) {
+        // Din starile universale restul cuvantului trebuie doar sa fie peste Sigma
+        if (earlyAccept && universal_states.count(currentState)) {
+            for (size_t j = i; j < word.size(); ++j)
+                if (!Sigma_alphabet.count(word[j]))
+                    return false;
+            return true;
         }
-        else {
-            // Nu exista tranzitie pentru acest simbol
+
+        // Verifica dacă exista o tranzitie pentru simbolul curent
+        auto it = delta_transition.find(make_pair(currentState, word[i]));
+        if (it == delta_transition.end())
+            // Nu exista tranzitie: starea capcana, cuvantul nu mai poate fi acceptat
             return false;
-        }
+        currentState = it->second;
     }
     // Verifics daca starea finala este una dintre starile finale
     return F_finalStates.count(currentState) > 0;
 }
 
+int DeterministicFiniteAutomaton::pruneDeadStates() {
+    map<int, vector<int>> successors, predecessors;
+    for (const auto& entry : delta_transition) {
+        successors[entry.first.first].push_back(entry.second);
+        predecessors[entry.second].push_back(entry.first.first);
+    }
+
+    auto reach = [](const set<int>& from, map<int, vector<int>>& edges) {
+        set<int> reached = from;
+        vector<int> st(from.begin(), from.end());
+        while (!st.empty()) {
+            int state = st.back();
+            st.pop_back();
+            for (int next : edges[state])
+                if (reached.insert(next).second)
+                    st.push_back(next);
+        }
+        return reached;
+    };
+
+    //accesibile din q0 si co-accesibile (ajung intr-o stare finala, pe tranzitiile inverse)
+    set<int> accessible = reach({ q0_initialState }, successors);
+    set<int> coAccessible = reach(F_finalStates, predecessors);
+
+    set<int> useful;
+    for (int state : Q_states)
+        if (accessible.count(state) && coAccessible.count(state))
+            useful.insert(state);
+    //starea initiala ramane chiar si cand limbajul e vid
+    if (Q_states.count(q0_initialState))
+        useful.insert(q0_initialState);
+
+    int removed = (int)(Q_states.size() - useful.size());
+
+    for (auto it = delta_transition.begin(); it != delta_transition.end(); ) {
+        if (!useful.count(it->first.first) || !useful.count(it->second))
+            it = delta_transition.erase(it);
+        else
+            ++it;
+    }
+    for (auto it = F_finalStates.begin(); it != F_finalStates.end(); ) {
+        if (!useful.count(*it))
+            it = F_finalStates.erase(it);
+        else
+            ++it;
+    }
+    Q_states = useful;
+
+    computeUniversalStates();
+    buildTransitionTable();
+    return removed;
+}
+
+void DeterministicFiniteAutomaton::computeUniversalStates() {
+    //cel mai mare punct fix, calculat invers: o stare nefinala sau incompleta nu e universala,
+    //si nici orice stare care ajunge in ea; le marcam pe tranzitiile inverse, fiecare o data
+    map<int, vector<int>> predecessors;
+    map<int, size_t> outgoing;
+    for (const auto& entry : delta_transition) {
+        if (!Sigma_alphabet.count(entry.first.second))
+            continue;
+        predecessors[entry.second].push_back(entry.first.first);
+        outgoing[entry.first.first]++;
+    }
+
+    set<int> notUniversal;
+    vector<int> worklist;
+    for (int state : Q_states) {
+        auto out = outgoing.find(state);
+        bool complete = out != outgoing.end() && out->second == Sigma_alphabet.size();
+        if (!F_finalStates.count(state) || !complete) {
+            notUniversal.insert(state);
+            worklist.push_back(state);
+        }
+    }
+    while (!worklist.empty()) {
+        int state = worklist.back();
+        worklist.pop_back();
+        auto from = predecessors.find(state);
+        if (from == predecessors.end())
+            continue;
+        for (int predecessor : from->second)
+            if (notUniversal.insert(predecessor).second)
+                worklist.push_back(predecessor);
+    }
+
+    universal_states.clear();
+    for (int state : Q_states)
+        if (!notUniversal.count(state))
+            universal_states.insert(state);
+}
+
+void DeterministicFiniteAutomaton::invalidateTransitionTable() {
+    universal_states.clear();
+    active_storage = TransitionStorage::Automatic;
+    row_flags.clear();
+    row_state.clear();
+    dense_table.clear();
+    comb_base.clear();
+    comb_default.clear();
+    comb_next.clear();
+    comb_check.clear();
+    table_start = -1;
+    table_width = 0;
+}
+
+void DeterministicFiniteAutomaton::setTransitionStorage(TransitionStorage storage) {
+    requested_storage = storage;
+    buildTransitionTable();
+}
+
+void DeterministicFiniteAutomaton::buildTransitionTable() {
+    set<int> universal = universal_states;
+    invalidateTransitionTable();
+    universal_states = universal;
+
+    if (Q_states.find(q0_initialState) == Q_states.end())
+        return;
+
+    table_width = Sigma_alphabet.size();
+    fill(begin(symbol_column), end(symbol_column), -1);
+    int column = 0;
+    for (char symbol : Sigma_alphabet)
+        symbol_column[(unsigned char)symbol] = column++;
+
+    map<int, int> row_of;
+    for (int state : Q_states) {
+        row_of[state] = (int)row_state.size();
+        row_state.push_back(state);
+    }
+
+    //randurile rare: (coloana, randul urmator), in ordinea coloanelor
+    vector<vector<pair<int, int>>> rows(row_state.size());
+    for (const auto& entry : delta_transition)
+        rows[row_of.at(entry.first.first)].push_back(
+            { symbol_column[(unsigned char)entry.first.second], row_of.at(entry.second) });
+
+    row_flags.assign(row_state.size(), 0);
+    for (int state : F_finalStates)
+        row_flags[row_of.at(state)] |= ROW_FINAL;
+    for (int state : universal_states)
+        row_flags[row_of.at(state)] |= ROW_UNIVERSAL;
+    table_start = row_of.at(q0_initialState);
+
+    size_t denseBytes = row_state.size() * table_width * sizeof(int);
+    TransitionStorage storage = requested_storage;
+    if (storage == TransitionStorage::Automatic)
+        storage = denseBytes > denseTableLimitBytes ? TransitionStorage::Compressed : TransitionStorage::Dense;
+
+    if (storage == TransitionStorage::Compressed) {
+        //randurile fara structura comuna nu se comprima; atunci Automatic revine la tabelul dens,
+        //de regula inainte de asezare, pe baza diferentelor fata de randurile sablon
+        bool automatic = requested_storage == TransitionStorage::Automatic;
+        bool built = buildCompressedTable(rows, automatic ? denseBytes : SIZE_MAX);
+        size_t compressedBytes = (comb_next.size() + comb_check.size() + 2 * comb_base.size()) * sizeof(int);
+        if (automatic && (!built || compressedBytes >= denseBytes)) {
+            comb_base.clear();
+            comb_default.clear();
+            comb_next.clear();
+            comb_check.clear();
+            storage = TransitionStorage::Dense;
+        }
+    }
+    if (storage == TransitionStorage::Dense)
+        buildDenseTable(rows);
+    active_storage = storage;
+}
+
+void DeterministicFiniteAutomaton::buildDenseTable(const vector<vector<pair<int, int>>>& rows) {
+    dense_table.assign(max<size_t>(1, rows.size() * table_width), -1);
+    for (size_t row = 0; row < rows.size(); ++row)
+        for (const auto& entry : rows[row])
+            dense_table[row * table_width + entry.first] = entry.second;
+}
+
+bool DeterministicFiniteAutomaton::buildCompressedTable(const vector<vector<pair<int, int>>>& rows, size_t maxBytes) {
+    const int templateWindow = 32;   // cate randuri sablon recente sunt incercate ca rand implicit
+    const int placementAttempts = 64; // pozitii incercate in zona ocupata inainte de a pune randul la final
+    const int empty = -1;
+
+    int rowCount = (int)rows.size();
+    int width = (int)table_width;
+    comb_base.assign(rowCount, 0);
+    comb_default.assign(rowCount, -1);
+
+    vector<int> full(width), candidate(width);
+    vector<int> templates;
+    vector<vector<pair<int, int>>> stored(rowCount);
+    size_t storedCells = 0;
+
+    auto expand = [width](const vector<pair<int, int>>& row, vector<int>& out) {
+        out.assign(width, -1);
+        for (const auto& entry : row)
+            out[entry.first] = entry.second;
+    };
+
+    //pasul 1: randul implicit al fiecarui rand si celulele care trebuie memorate explicit
+    for (int row = 0; row < rowCount; ++row) {
+        expand(rows[row], full);
+
+        //alegem sablonul cu cele mai putine diferente; daca nu castigam nimic, randul devine sablon
+        int bestTemplate = -1;
+        size_t bestDifferences = rows[row].size();
+        int firstCandidate = max(0, (int)templates.size() - templateWindow);
+        for (int t = (int)templates.size() - 1; t >= firstCandidate; --t) {
+            expand(rows[templates[t]], candidate);
+            size_t differences = 0;
+            for (int c = 0; c < width && differences < bestDifferences; ++c)
+                differences += full[c] != candidate[c];
+            if (differences < bestDifferences) {
+                bestDifferences = differences;
+                bestTemplate = templates[t];
+            }
+        }
+
+        if (bestTemplate >= 0) {
+            comb_default[row] = bestTemplate;
+            expand(rows[bestTemplate], candidate);
+            //si absenta unei tranzitii trebuie memorata explicit daca sablonul o are
+            for (int c = 0; c < width; ++c)
+                if (full[c] != candidate[c])
+                    stored[row].push_back({ c, full[c] });
+        }
+        else {
+            templates.push_back(row);
+            stored[row] = rows[row];
+        }
+        storedCells += stored[row].size();
+    }
+
+    //estimare fara goluri: daca nici asa nu castigam fata de limita, nu mai construim vectorul
+    size_t estimatedBytes = (2 * storedCells + 2 * (size_t)rowCount) * sizeof(int);
+    if (estimatedBytes >= maxBytes) {
+        comb_base.clear();
+        comb_default.clear();
+        return false;
+    }
+
+    //pasul 2: asezarea randurilor. next_free sare peste celulele ocupate (cu comprimarea
+    //drumului), deci fiecare conflict muta baza direct la urmatoarea celula libera
+    vector<size_t> nextFree;
+    auto findFree = [&nextFree](size_t slot) {
+        size_t root = slot;
+        while (root < nextFree.size() && nextFree[root] != root)
+            root = nextFree[root];
+        while (slot < nextFree.size() && nextFree[slot] != slot) {
+            size_t next = nextFree[slot];
+            nextFree[slot] = root;
+            slot = next;
+        }
+        return root;
+    };
+
+    for (int row = 0; row < rowCount; ++row) {
+        const vector<pair<int, int>>& cells = stored[row];
+        if (cells.empty())
+            continue;
+
+        size_t first = (size_t)cells.front().first;
+        size_t base = findFree(first) - first;
+        bool fits = false;
+        for (int attempt = 0; attempt < placementAttempts && !fits; ++attempt) {
+            fits = true;
+            for (const auto& entry : cells) {
+                size_t slot = base + entry.first;
+                if (slot < comb_check.size() && comb_check[slot] != empty) {
+                    base = findFree(slot) - entry.first;
+                    fits = false;
+                    break;
+                }
+            }
+        }
+        //dupa sfarsitul vectorului toate celulele sunt libere
+        if (!fits)
+            base = max(comb_check.size(), first) - first;
+
+        size_t needed = base + cells.back().first + 1;
+        if (comb_check.size() < needed) {
+            size_t old = nextFree.size();
+            comb_check.resize(needed, empty);
+            comb_next.resize(needed, -1);
+            nextFree.resize(needed);
+            for (size_t slot = old; slot < needed; ++slot)
+                nextFree[slot] = slot;
+        }
+        comb_base[row] = (int)base;
+        for (const auto& entry : cells) {
+            comb_check[base + entry.first] = row;
+            comb_next[base + entry.first] = entry.second;
+            nextFree[base + entry.first] = base + entry.first + 1;
+        }
+    }
+
+    //orice base + coloana trebuie sa fie un indice valid
+    int maxBase = 0;
+    for (int base : comb_base)
+        maxBase = max(maxBase, base);
+    size_t size = (size_t)maxBase + width;
+    if (comb_check.size() < size) {
+        comb_check.resize(size, empty);
+        comb_next.resize(size, -1);
+    }
+    return true;
+}
+
+int DeterministicFiniteAutomaton::compressedNext(int row, int column) const {
+    int slot = comb_base[row] + column;
+    if (comb_check[slot] == row)
+        return comb_next[slot];
+    int fallback = comb_default[row];
+    if (fallback < 0)
+        return -1;
+    slot = comb_base[fallback] + column;
+    return comb_check[slot] == fallback ? comb_next[slot] : -1;
+}
+
+bool DeterministicFiniteAutomaton::hasTransitionTable() const {
+    return active_storage != TransitionStorage::Automatic;
+}
+
+TransitionStorage DeterministicFiniteAutomaton::getTransitionStorage() const {
+    return active_storage;
+}
+
+size_t DeterministicFiniteAutomaton::transitionTableBytes() const {
+    return row_flags.size() + row_state.size() * sizeof(int) + dense_table.size() * sizeof(int)
+        + (comb_base.size() + comb_default.size() + comb_next.size() + comb_check.size()) * sizeof(int);
+}
+
+vector<int> DeterministicFiniteAutomaton::bfsOrder() const {
+    map<int, vector<int>> successors;
+    for (const auto& entry : delta_transition)
+        successors[entry.first.first].push_back(entry.second);
+
+    vector<int> order;
+    set<int> visited;
+    queue<int> states_to_process;
+    if (Q_states.count(q0_initialState)) {
+        visited.insert(q0_initialState);
+        states_to_process.push(q0_initialState);
+    }
+    while (!states_to_process.empty()) {
+        int state = states_to_process.front();
+        states_to_process.pop();
+        order.push_back(state);
+        for (int next : successors[state])
+            if (visited.insert(next).second)
+                states_to_process.push(next);
+    }
+    //starile inaccesibile raman la final, in ordinea lui Q
+    for (int state : Q_states)
+        if (!visited.count(state))
+            order.push_back(state);
+    return order;
+}
+
+void DeterministicFiniteAutomaton::renumberStates(const vector<int>& order) {
+    map<int, int> renamed;
+    for (int state : order)
+        if (Q_states.count(state) && !renamed.count(state))
+            renamed[state] = (int)renamed.size();
+    for (int state : bfsOrder())
+        if (!renamed.count(state))
+            renamed[state] = (int)renamed.size();
+
+    set<int> new_q_states, new_f_states, new_universal_states;
+    map<pair<int, char>, int> new_delta;
+    for (int state : Q_states)
+        new_q_states.insert(renamed.at(state));
+    for (int state : F_finalStates)
+        new_f_states.insert(renamed.at(state));
+    for (int state : universal_states)
+        new_universal_states.insert(renamed.at(state));
+    for (const auto& entry : delta_transition)
+        new_delta[{renamed.at(entry.first.first), entry.first.second}] = renamed.at(entry.second);
+
+    bool hadTable = hasTransitionTable();
+    Q_states = new_q_states;
+    F_finalStates = new_f_states;
+    delta_transition = new_delta;
+    if (renamed.count(q0_initialState))
+        q0_initialState = renamed.at(q0_initialState);
+    universal_states = new_universal_states;
+
+    if (hadTable)
+        buildTransitionTable();
+}
+
+void DeterministicFiniteAutomaton::reorderStatesByHotness(const vector<string>& sample) {
+    map<int, size_t> visits;
+    for (const string& word : sample) {
+        int currentState = q0_initialState;
+        visits[currentState]++;
+        for (char symbol : word) {
+            auto it = delta_transition.find({ currentState, symbol });
+            if (it == delta_transition.end())
+                break;
+            currentState = it->second;
+            visits[currentState]++;
+        }
+    }
+
+    //la egalitate pastram ordinea BFS, deci fara esantion renumerotarea e doar BFS
+    vector<int> order = bfsOrder();
+    stable_sort(order.begin(), order.end(), [&visits](int x, int y) {
+        auto vx = visits.find(x), vy = visits.find(y);
+        size_t cx = vx == visits.end() ? 0 : vx->second;
+        size_t cy = vy == visits.end() ? 0 : vy->second;
+        return cx > cy;
+    });
+    renumberStates(order);
+}
+
+DeterministicFiniteAutomaton DeterministicFiniteAutomaton::minimize() const {
+    //fara stare initiala valida (de ex. automat construit implicit) limbajul este vid
+    if (Q_states.find(q0_initialState) == Q_states.end()) {
+        DeterministicFiniteAutomaton empty;
+        empty.setQ({ 0 });
+        empty.setSigma(Sigma_alphabet);
+        empty.setQ0(0);
+        empty.computeUniversalStates();
+        empty.buildTransitionTable();
+        return empty;
+    }
+
+    // indici compacti 0..n-1 pt stari, n = starea moarta implicita (tranzitiile lipsa)
+    vector<int> states(Q_states.begin(), Q_states.end());
+    vector<char> symbols(Sigma_alphabet.begin(), Sigma_alphabet.end());
+    int n = (int)states.size();
+    int total = n + 1;
+    int k = (int)symbols.size();
+
+    map<int, int> index;
+    for (int i = 0; i < n; ++i)
+        index[states[i]] = i;
+
+    //tranzitii inverse: inverse[c][t] = starile care ajung in t pe simbolul c
+    vector<vector<vector<int>>> inverse(k, vector<vector<int>>(total));
+    for (int c = 0; c < k; ++c)
+        for (int i = 0; i < total; ++i) {
+            int target = n;
+            if (i < n) {
+                auto it = delta_transition.find({ states[i], symbols[c] });
+                if (it != delta_transition.end())
+                    target = index.at(it->second);
+            }
+            inverse[c][target].push_back(i);
+        }
+
+    // partitie rafinabila: elems e o permutare, fiecare bloc e un interval [start, end)
+    vector<int> elems(total), location(total), blockOf(total);
+    vector<int> blockStart, blockEnd, blockMarked;
+    int pos = 0;
+    for (int pass = 0; pass < 2; ++pass) {
+        int begin = pos;
+        for (int i = 0; i < total; ++i) {
+            bool isFinal = i < n && F_finalStates.count(states[i]);
+            if (isFinal == (pass == 0)) {
+                elems[pos] = i;
+                location[i] = pos;
+                blockOf[i] = (int)blockStart.size();
+                pos++;
+            }
+        }
+        if (pos > begin) {
+            blockStart.push_back(begin);
+            blockEnd.push_back(pos);
+            blockMarked.push_back(0);
+        }
+    }
+
+    vector<int> worklist;
+    vector<bool> inWorklist(blockStart.size(), false);
+    for (int b = 0; b < (int)blockStart.size(); ++b) {
+        worklist.push_back(b);
+        inWorklist[b] = true;
+    }
+
+    vector<int> splitter, touched;
+    while (!worklist.empty()) {
+        int a = worklist.back();
+        worklist.pop_back();
+        inWorklist[a] = false;
+        splitter.assign(elems.begin() + blockStart[a], elems.begin() + blockEnd[a]);
+
+        for (int c = 0; c < k; ++c) {
+            //marcam predecesorii mutandu-i la inceputul blocului lor
+            touched.clear();
+            for (int t : splitter)
+                for (int s : inverse[c][t]) {
+                    int b = blockOf[s];
+                    int markPos = blockStart[b] + blockMarked[b];
+                    if (location[s] < markPos)
+                        continue;
+                    if (blockMarked[b] == 0)
+                        touched.push_back(b);
+                    int other = elems[markPos];
+                    swap(elems[markPos], elems[location[s]]);
+                    location[other] = location[s];
+                    location[s] = markPos;
+                    blockMarked[b]++;
+                }
+
+            //impartim blocurile atinse partial
+            for (int b : touched) {
+                int marked = blockMarked[b];
+                blockMarked[b] = 0;
+                int size = blockEnd[b] - blockStart[b];
+                if (marked == size)
+                    continue;
+
+                int nb = (int)blockStart.size();
+                blockStart.push_back(blockStart[b]);
+                blockEnd.push_back(blockStart[b] + marked);
+                blockMarked.push_back(0);
+                inWorklist.push_back(false);
+                blockStart[b] += marked;
+                for (int p = blockStart[nb]; p < blockEnd[nb]; ++p)
+                    blockOf[elems[p]] = nb;
+
+                if (inWorklist[b] || marked <= size - marked) {
+                    worklist.push_back(nb);
+                    inWorklist[nb] = true;
+                }
+                else {
+                    worklist.push_back(b);
+                    inWorklist[b] = true;
+                }
+            }
+        }
+    }
+
+    //construim AFD-ul din blocuri, doar cele accesibile din q0, fara blocul mort
+    DeterministicFiniteAutomaton minimal;
+    int deadBlock = blockOf[n];
+    map<int, int> blockToState;
+    set<int> min_q_states, min_f_states;
+    map<pair<int, char>, int> min_delta;
+    queue<int> blocks_to_process;
+
+    int startBlock = blockOf[index.at(q0_initialState)];
+    blockToState[startBlock] = 0;
+    min_q_states.insert(0);
+    minimal.setQ0(0);
+    blocks_to_process.push(startBlock);
+
+    while (!blocks_to_process.empty()) {
+        int b = blocks_to_process.front();
+        blocks_to_process.pop();
+        int current = blockToState.at(b);
+        int representative = elems[blockStart[b]];
+
+        if (F_finalStates.count(states[representative]))
+            min_f_states.insert(current);
+
+        for (char symbol : symbols) {
+            auto it = delta_transition.find({ states[representative], symbol });
+            if (it == delta_transition.end())
+                continue;
+            int targetBlock = blockOf[index.at(it->second)];
+            if (targetBlock == deadBlock)
+                continue;
+
+            if (!blockToState.count(targetBlock)) {
+                int next = (int)blockToState.size();
+                blockToState[targetBlock] = next;
+                min_q_states.insert(next);
+                blocks_to_process.push(targetBlock);
+            }
+            min_delta[{current, symbol}] = blockToState.at(targetBlock);
+        }
+    }
+
+    minimal.setQ(min_q_states);
+    minimal.setSigma(Sigma_alphabet);
+    minimal.setDelta(min_delta);
+    minimal.setF(min_f_states);
+    minimal.computeUniversalStates();
+    minimal.buildTransitionTable();
+    return minimal;
+}
+
+DeterministicFiniteAutomaton DeterministicFiniteAutomaton::product(const DeterministicFiniteAutomaton& a,
+    const DeterministicFiniteAutomaton& b, ProductOperation operation, bool minimizeResult) {
+    const int dead = -1;
+
+    set<char> alphabet = a.Sigma_alphabet;
+    alphabet.insert(b.Sigma_alphabet.begin(), b.Sigma_alphabet.end());
+
+    auto step = [dead](const DeterministicFiniteAutomaton& dfa, int state, char symbol) {
+        if (state == dead)
+            return dead;
+        auto it = dfa.delta_transition.find({ state, symbol });
+        return it == dfa.delta_transition.end() ? dead : it->second;
+    };
+
+    auto accepts = [operation](bool inA, bool inB) {
+        switch (operation) {
+        case ProductOperation::Intersection: return inA && inB;
+        case ProductOperation::Union: return inA || inB;
+        default: return inA && !inB;
+        }
+    };
+
+    //perechile din care limbajul produsului e sigur vid nu mai sunt explorate
+    auto isDeadPair = [operation, dead](int p, int q) {
+        switch (operation) {
+        case ProductOperation::Intersection: return p == dead || q == dead;
+        case ProductOperation::Union: return p == dead && q == dead;
+        default: return p == dead;
+        }
+    };
+
+    DeterministicFiniteAutomaton result;
+    map<pair<int, int>, int> pair_states_map;
+    set<int> product_q_states, product_f_states;
+    map<pair<int, char>, int> product_delta;
+    queue<pair<int, int>> pairs_to_process;
+
+    pair<int, int> start = { a.q0_initialState, b.q0_initialState };
+    pair_states_map[start] = 0;
+    product_q_states.insert(0);
+    result.setQ0(0);
+    pairs_to_process.push(start);
+
+    while (!pairs_to_process.empty()) {
+        pair<int, int> current = pairs_to_process.front();
+        pairs_to_process.pop();
+        int current_state = pair_states_map.at(current);
+
+        bool inA = current.first != dead && a.F_finalStates.count(current.first);
+        bool inB = current.second != dead && b.F_finalStates.count(current.second);
+        if (accepts(inA, inB))
+            product_f_states.insert(current_state);
+
+        if (isDeadPair(current.first, current.second))
+            continue;
+
+        for (char symbol : alphabet) {
+            pair<int, int> target = { step(a, current.first, symbol), step(b, current.second, symbol) };
+            if (isDeadPair(target.first, target.second))
+                continue;
+
+            int target_state;
+            auto it = pair_states_map.find(target);
+            if (it != pair_states_map.end())
+                target_state = it->second;
+            else {
+                target_state = (int)pair_states_map.size();
+                pair_states_map[target] = target_state;
+                product_q_states.insert(target_state);
+                pairs_to_process.push(target);
+            }
+            product_delta[{current_state, symbol}] = target_state;
+        }
+    }
+
+    result.setQ(product_q_states);
+    result.setSigma(alphabet);
+    result.setDelta(product_delta);
+    result.setF(product_f_states);
+    result.pruneDeadStates();
+
+    return minimizeResult ? result.minimize() : result;
+}
+
+DeterministicFiniteAutomaton DeterministicFiniteAutomaton::intersectWith(const DeterministicFiniteAutomaton& other, bool minimizeResult) const {
+    return product(*this, other, ProductOperation::Intersection, minimizeResult);
+}
+
+DeterministicFiniteAutomaton DeterministicFiniteAutomaton::unionWith(const DeterministicFiniteAutomaton& other, bool minimizeResult) const {
+    return product(*this, other, ProductOperation::Union, minimizeResult);
+}
+
+DeterministicFiniteAutomaton DeterministicFiniteAutomaton::differenceWith(const DeterministicFiniteAutomaton& other, bool minimizeResult) const {
+    return product(*this, other, ProductOperation::Difference, minimizeResult);
+}
+
+DeterministicFiniteAutomaton DeterministicFiniteAutomaton::complete(const set<char>& extraSymbols) const {
+    DeterministicFiniteAutomaton result = *this;
+    result.Sigma_alphabet.insert(extraSymbols.begin(), extraSymbols.end());
+
+    //starea moarta primeste primul indice liber
+    int deadState = Q_states.empty() ? 0 : *Q_states.rbegin() + 1;
+    bool deadUsed = false;
+
+    for (int state : Q_states)
+        for (char symbol : result.Sigma_alphabet)
+            if (!result.delta_transition.count({ state, symbol })) {
+                result.delta_transition[{state, symbol}] = deadState;
+                deadUsed = true;
+            }
+
+    if (deadUsed) {
+        result.Q_states.insert(deadState);
+        for (char symbol : result.Sigma_alphabet)
+            result.delta_transition[{deadState, symbol}] = deadState;
+    }
+
+    //copia are tabelul si starile universale calculate pe vechiul Sigma
+    result.invalidateTransitionTable();
+    result.computeUniversalStates();
+    result.buildTransitionTable();
+    return result;
+}
+
+DeterministicFiniteAutomaton DeterministicFiniteAutomaton::complement(const set<char>& extraSymbols, bool minimizeResult) const {
+    DeterministicFiniteAutomaton result = complete(extraSymbols);
+
+    set<int> complement_f_states;
+    for (int state : result.Q_states)
+        if (!result.F_finalStates.count(state))
+            complement_f_states.insert(state);
+    result.F_finalStates = complement_f_states;
+    result.pruneDeadStates();
+
+    return minimizeResult ? result.minimize() : result;
+}
 
+bool DeterministicFiniteAutomaton::equivalent(const DeterministicFiniteAutomaton& a,
+    const DeterministicFiniteAutomaton& b, string* counterexample) {
+    vector<char> alphabet = sharedAlphabet(a, b);
+    IndexedAutomaton A(a, alphabet), B(b, alphabet);
+
+    //starile lui B sunt decalate dupa cele ale lui A intr-o singura padure union-find
+    int offset = A.dead + 1;
+    vector<int> parent(offset + B.dead + 1), rank(parent.size(), 0);
+    iota(parent.begin(), parent.end(), 0);
+
+    auto find = [&](int x) {
+        while (parent[x] != x) {
+            parent[x] = parent[parent[x]];
+            x = parent[x];
+        }
+        return x;
+    };
+    auto unite = [&](int x, int y) {
+        x = find(x);
+        y = find(y);
+        if (x == y)
+            return false;
+        if (rank[x] < rank[y])
+            swap(x, y);
+        parent[y] = x;
+        if (rank[x] == rank[y])
+            rank[x]++;
+        return true;
+    };
+
+    bool same = true;
+    queue<pair<int, int>> pairs_to_process;
+    unite(A.start, offset + B.start);
+    pairs_to_process.push({ A.start, B.start });
+
+    while (!pairs_to_process.empty() && same) {
+        auto [p, q] = pairs_to_process.front();
+        pairs_to_process.pop();
+
+        if (A.accepting[p] != B.accepting[q]) {
+            same = false;
+            break;
+        }
+        for (size_t c = 0; c < alphabet.size(); ++c) {
+            int pNext = A.next(p, c), qNext = B.next(q, c);
+            if (unite(pNext, offset + qNext))
+                pairs_to_process.push({ pNext, qNext });
+        }
+    }
+
+    if (same)
+        return true;
+
+    //Hopcroft-Karp nu garanteaza un martor minim, il cautam separat doar cand limbajele difera
+    if (counterexample)
+        shortestWitness(a, b, [](bool inA, bool inB) { return inA != inB; }, counterexample);
+    return false;
+}
+
+bool DeterministicFiniteAutomaton::includes(const DeterministicFiniteAutomaton& a,
+    const DeterministicFiniteAutomaton& b, string* counterexample) {
+    return !shortestWitness(a, b, [](bool inA, bool inB) { return inB && !inA; }, counterexample);
+}
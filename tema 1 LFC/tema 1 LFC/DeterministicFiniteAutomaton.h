@@ -9,6 +9,19 @@
 #include <sstream>
 using namespace std;
 
+// operatii pe produsul cartezian a doua AFD-uri
+enum class ProductOperation {
+    Intersection,   // L(A) ∩ L(B)
+    Union,          // L(A) ∪ L(B)
+    Difference      // L(A) \ L(B)
+};
+
+// reprezentarea tabelului de tranzitii folosit de checkWord
+enum class TransitionStorage {
+    Automatic,      // dens cat timp incape in limita de memorie, altfel comprimat
+    Dense,          // un rand complet per stare
+    Compressed      // vector pieptene (row displacement) cu randuri implicite, ca in flex
+};
 
 class DeterministicFiniteAutomaton
 {
@@ -16,8 +29,42 @@ private:
     set<int> Q_states;                           // Q - Multimea starilor
     set<char> Sigma_alphabet;                    // Sigma - Alfabetul de intrare
     map<pair<int, char>, int> delta_transition;  // delta - Funcția de tranziție (stare, simbol) -> stare noua
-    int q0_initialState;                         // q0 - Starea initiala
+    int q0_initialState = -1;                    // q0 - Starea initiala
     set<int> F_finalStates;                      // F - Multimea starilor finale
+    set<int> universal_states;                   // stari finale din care orice continuare peste Sigma e acceptata
+
+    // tabelul folosit de checkWord: un rand per stare (in ordinea lui Q), o coloana per simbol din Sigma
+    TransitionStorage requested_storage = TransitionStorage::Automatic;
+    TransitionStorage active_storage = TransitionStorage::Automatic;   // Automatic = niciun tabel construit
+    vector<unsigned char> row_flags;             // ROW_FINAL / ROW_UNIVERSAL pentru fiecare rand
+    vector<int> row_state;                       // starea din Q corespunzatoare fiecarui rand
+    int symbol_column[256] = {};                 // coloana fiecarui octet, -1 daca nu apartine lui Sigma
+    int table_start = -1;
+    size_t table_width = 0;
+
+    // Dense: dense_table[rand * latime + coloana] = randul urmator sau -1
+    vector<int> dense_table;
+
+    // Compressed: intrarea (rand, coloana) se afla la comb_base[rand] + coloana daca comb_check o confirma,
+    // altfel se cauta in randul implicit comb_default[rand] (care nu are la randul lui alt rand implicit)
+    vector<int> comb_base;
+    vector<int> comb_default;
+    vector<int> comb_next;
+    vector<int> comb_check;
+
+    static constexpr unsigned char ROW_FINAL = 1;
+    static constexpr unsigned char ROW_UNIVERSAL = 2;
+
+    void buildDenseTable(const vector<vector<pair<int, int>>>& rows);
+    // false (fara tabel) daca estimarea dupa alegerea randurilor implicite depaseste maxBytes
+    bool buildCompressedTable(const vector<vector<pair<int, int>>>& rows, size_t maxBytes);
+    int compressedNext(int row, int column) const;
+    template <typename NextRow>
+    bool scanTable(const string& word, NextRow nextRow) const;
+
+    void computeUniversalStates();
+    void invalidateTransitionTable();
+    vector<int> bfsOrder() const;
 
 public: 
     // setteri
@@ -27,9 +74,64 @@ public:
     void setQ0(int q0);
     void setF(const set<int>& F);
 
+    // getteri
+    const set<int>& getQ() const;
+    const set<char>& getSigma() const;
+    const map<pair<int, char>, int>& getDelta() const;
+    int getQ0() const;
+    const set<int>& getF() const;
+
 	// verif daca e automat valid
     bool verifyAutomaton() const; 
     void printAutomaton(ostream& os) const;  
+    // scrie o functie C++ de sine statatoare, bool functionName(const char* data, size_t length),
+    // cu cod direct (goto intre etichete de stare) echivalent cu checkWord
+    void emitCpp(ostream& os, const string& functionName) const;
 	bool checkWord(const string& word) const;
+
+    // elimina starile inaccesibile din q0 si pe cele din care nu se mai ajunge intr-o stare finala;
+    // tranzitiile lipsa raman singura stare capcana (implicita), deci checkWord respinge imediat
+    int pruneDeadStates();
+
+    // tabelul dens depaseste limita => Automatic alege reprezentarea comprimata
+    static constexpr size_t denseTableLimitBytes = 4u << 20;
+
+    // reconstruieste tabelul din delta in reprezentarea ceruta; setterii il invalideaza, iar pana
+    // la reconstruire checkWord cauta direct in delta
+    void buildTransitionTable();
+    void setTransitionStorage(TransitionStorage storage);
+    bool hasTransitionTable() const;
+    TransitionStorage getTransitionStorage() const;   // Dense sau Compressed; Automatic daca nu exista tabel
+    size_t transitionTableBytes() const;
+
+    // renumeroteaza starile 0..n-1 in ordinea data (starile lipsa sunt adaugate la final, in ordine BFS)
+    void renumberStates(const vector<int>& order);
+    // ruleaza cuvintele din sample, numara vizitele fiecarei stari si renumeroteaza starile
+    // descrescator dupa numarul de vizite, ca randurile fierbinti sa fie vecine in tabel
+    void reorderStatesByHotness(const vector<string>& sample);
+
+    // AFD minimal echivalent (Hopcroft), starile renumerotate in ordine BFS
+    DeterministicFiniteAutomaton minimize() const;
+
+    // construiesc doar starile accesibile ale produsului, pe alfabetul comun Sigma_A ∪ Sigma_B;
+    // tranzitiile lipsa sunt tratate ca o stare moarta implicita
+    static DeterministicFiniteAutomaton product(const DeterministicFiniteAutomaton& a,
+        const DeterministicFiniteAutomaton& b, ProductOperation operation, bool minimizeResult = false);
+    DeterministicFiniteAutomaton intersectWith(const DeterministicFiniteAutomaton& other, bool minimizeResult = false) const;
+    DeterministicFiniteAutomaton unionWith(const DeterministicFiniteAutomaton& other, bool minimizeResult = false) const;
+    DeterministicFiniteAutomaton differenceWith(const DeterministicFiniteAutomaton& other, bool minimizeResult = false) const;
+
+    // AFD complet pe Sigma ∪ extraSymbols: tranzitiile lipsa duc intr-o stare moarta explicita
+    DeterministicFiniteAutomaton complete(const set<char>& extraSymbols = {}) const;
+    // complementul fata de (Sigma ∪ extraSymbols)*
+    DeterministicFiniteAutomaton complement(const set<char>& extraSymbols = {}, bool minimizeResult = false) const;
+
+    // L(a) = L(b)? Hopcroft-Karp cu union-find; daca difera, counterexample primeste
+    // cel mai scurt cuvant acceptat de exact unul dintre automate
+    static bool equivalent(const DeterministicFiniteAutomaton& a, const DeterministicFiniteAutomaton& b,
+        string* counterexample = nullptr);
+    // L(b) ⊆ L(a)? counterexample = cel mai scurt cuvant din L(b) \ L(a)
+    static bool includes(const DeterministicFiniteAutomaton& a, const DeterministicFiniteAutomaton& b,
+        string* counterexample = nullptr);
 };
 
@@ -0,0 +1,84 @@
+#include "LazyDeterministicAutomaton.h"
+#include <stdexcept>
+
+LazyDeterministicAutomaton::LazyDeterministicAutomaton(NondeterministicFiniteAutomaton automaton, size_t maxCachedStates)
+    : nfa(std::move(automaton)), max_cached_states(maxCachedStates < 2 ? 2 : maxCachedStates),
+    start_state(-1), computed_transitions(0), cache_flushes(0) {
+    if (nfa.getQ0() == -1)
+        throw runtime_error("LazyDeterministicAutomaton: stare initiala neinitializata (q0 = -1).");
+    resetCache();
+}
+
+void LazyDeterministicAutomaton::resetCache() const {
+    state_sets.clear();
+    state_index.clear();
+    transitions.clear();
+    final_flags.clear();
+    start_state = addState(nfa.lambdaClosure({ nfa.getQ0() }));
+}
+
+int LazyDeterministicAutomaton::addState(set<int>&& nfaStates) const {
+    auto found = state_index.find(nfaStates);
+    if (found != state_index.end())
+        return found->second;
+
+    int id = (int)state_sets.size();
+    bool isFinal = false;
+    for (int state : nfaStates)
+        if (nfa.getF().count(state)) {
+            isFinal = true;
+            break;
+        }
+
+    state_index.emplace(nfaStates, id);
+    state_sets.push_back(std::move(nfaStates));
+    transitions.resize(transitions.size() + 256, unknownTransition);
+    final_flags.push_back(isFinal);
+    return id;
+}
+
+int LazyDeterministicAutomaton::computeTransition(int state, unsigned char symbol) const {
+    computed_transitions++;
+    set<int> target = nfa.lambdaClosure(nfa.move(state_sets[state], (char)symbol));
+    if (target.empty()) {
+        transitions[(size_t)state * 256 + symbol] = deadTransition;
+        return deadTransition;
+    }
+
+    //cache plin: pastram doar tinta si o reluam ca stare noua
+    if (state_sets.size() >= max_cached_states && !state_index.count(target)) {
+        cache_flushes++;
+        resetCache();
+        return addState(std::move(target));
+    }
+
+    int next = addState(std::move(target));
+    transitions[(size_t)state * 256 + symbol] = next;
+    return next;
+}
+
+bool LazyDeterministicAutomaton::checkWord(const string& word) const {
+    int state = start_state;
+    for (char c : word) {
+        unsigned char symbol = (unsigned char)c;
+        int next = transitions[(size_t)state * 256 + symbol];
+        if (next == unknownTransition)
+            next = computeTransition(state, symbol);
+        if (next == deadTransition)
+            return false;
+        state = next;
+    }
+    return final_flags[state] != 0;
+}
+
+size_t LazyDeterministicAutomaton::cachedStates() const {
+    return state_sets.size();
+}
+
+size_t LazyDeterministicAutomaton::computedTransitions() const {
+    return computed_transitions;
+}
+
+size_t LazyDeterministicAutomaton::cacheFlushes() const {
+    return cache_flushes;
+}
@@ -0,0 +1,46 @@
+#pragma once
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+#include "NondeterministicFiniteAutomaton.h"
+
+using namespace std;
+
+// AFD construit la cerere din AFN: o stare (multime de stari AFN) si o tranzitie se calculeaza
+// abia cand cuvantul le atinge, apoi raman in cache. Cand cache-ul depaseste maxCachedStates
+// el este golit si reconstruit de la starea curenta, deci memoria ramane marginita chiar daca
+// AFD-ul complet ar fi exponential. checkWord modifica cache-ul: nu este sigur intre fire.
+class LazyDeterministicAutomaton
+{
+private:
+    static constexpr int unknownTransition = -2;   // tranzitie necalculata inca
+    static constexpr int deadTransition = -1;      // multimea vida de stari AFN
+
+    NondeterministicFiniteAutomaton nfa;
+    size_t max_cached_states;
+
+    mutable vector<set<int>> state_sets;       // starea i -> multimea de stari AFN
+    mutable map<set<int>, int> state_index;
+    mutable vector<int> transitions;           // state * 256 + octet
+    mutable vector<char> final_flags;
+    mutable int start_state;
+    mutable size_t computed_transitions;
+    mutable size_t cache_flushes;
+
+    int addState(set<int>&& nfaStates) const;
+    int computeTransition(int state, unsigned char symbol) const;
+    void resetCache() const;
+
+public:
+    static constexpr size_t defaultMaxCachedStates = 4096;
+
+    explicit LazyDeterministicAutomaton(NondeterministicFiniteAutomaton automaton,
+        size_t maxCachedStates = defaultMaxCachedStates);
+
+    bool checkWord(const string& word) const;
+
+    size_t cachedStates() const;
+    size_t computedTransitions() const;   // cate tranzitii au necesitat move/lambdaClosure
+    size_t cacheFlushes() const;
+};
@@ -0,0 +1,225 @@
+#include "MatchPlanner.h"
+#include "RegexParser.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+    // costuri relative (un pas in tabelul AFD = 1), calibrate grosier dupa lfc_benchmarks
+    const double tableStepCost = 1;
+    const double lazyStepCost = 1.5;          // cautarea in cache + verificarea tranzitiei necalculate
+    const double setOperationCost = 40;       // o stare AFN trecuta prin move/lambdaClosure (set/map)
+    const double bitParallelBaseCost = 2;
+    const double bitParallelChunkCost = 1;    // o citire din follow_table pentru fiecare octet din D
+    const double minimizeStepCost = 4;
+    const double cacheMissPenalty = 2;        // pe octet, cand tabelul nu incape in cache
+    const size_t cacheBytes = 256 << 10;
+    const double tableBytesPerCell = sizeof(int);
+    const double minimizedShrink = 0.5;       // presupunere: Hopcroft injumatateste AFD-ul
+
+    struct CostEstimate {
+        double build;
+        double perByte;
+    };
+
+    double tablePenalty(double tableBytes) {
+        return tableBytes > cacheBytes ? cacheMissPenalty : 0;
+    }
+
+    // dfaStates este estimarea (pozitii + 1) inainte de constructie, apoi numarul real
+    CostEstimate estimate(MatchEngine engine, const MatchPlan& plan, double dfaStates, double minimizedStates) {
+        double n = (double)plan.nfaStates;
+        double k = (double)(plan.alphabetSize ? plan.alphabetSize : 1);
+        double bytes = (double)plan.expectedInputBytes;
+        double subsetStep = n * setOperationCost;   // move + lambdaClosure pentru o multime de stari
+
+        switch (engine) {
+        case MatchEngine::BitParallel: {
+            double chunks = (double)(plan.positions / 8 + 1);
+            return { 256 * chunks + (double)plan.positions * plan.positions,
+                bitParallelBaseCost + bitParallelChunkCost * chunks };
+        }
+        case MatchEngine::NFASimulation:
+            return { subsetStep, subsetStep };
+        case MatchEngine::LazyDFA: {
+            //fiecare tranzitie atinsa prima data costa cat un pas din determinizare
+            double misses = min(dfaStates * k, bytes);
+            return { subsetStep + misses * subsetStep, lazyStepCost };
+        }
+        case MatchEngine::DFA: {
+            double build = dfaStates * k * subsetStep;
+            return { build, tableStepCost + tablePenalty(dfaStates * k * tableBytesPerCell) };
+        }
+        case MatchEngine::MinimizedDFA: {
+            double build = dfaStates * k * subsetStep
+                + dfaStates * k * log2(dfaStates + 1) * minimizeStepCost;
+            return { build, tableStepCost + tablePenalty(minimizedStates * k * tableBytesPerCell) };
+        }
+        }
+        return { 0, 0 };
+    }
+
+    void applyEstimate(MatchPlan& plan, MatchEngine engine, double dfaStates, double minimizedStates) {
+        CostEstimate cost = estimate(engine, plan, dfaStates, minimizedStates);
+        plan.engine = engine;
+        plan.buildCost = cost.build;
+        plan.costPerByte = cost.perByte;
+        plan.estimatedCost = cost.build + cost.perByte * (double)plan.expectedInputBytes;
+    }
+
+    MatchEngine cheapest(const vector<MatchEngine>& candidates, const MatchPlan& plan, double dfaStates, double minimizedStates) {
+        MatchEngine best = candidates.front();
+        double bestCost = -1;
+        for (MatchEngine engine : candidates) {
+            CostEstimate cost = estimate(engine, plan, dfaStates, minimizedStates);
+            double total = cost.build + cost.perByte * (double)plan.expectedInputBytes;
+            if (bestCost < 0 || total < bestCost) {
+                best = engine;
+                bestCost = total;
+            }
+        }
+        return best;
+    }
+}
+
+string engineName(MatchEngine engine) {
+    switch (engine) {
+    case MatchEngine::BitParallel: return "bit-parallel";
+    case MatchEngine::NFASimulation: return "nfa";
+    case MatchEngine::LazyDFA: return "lazy-dfa";
+    case MatchEngine::DFA: return "dfa";
+    case MatchEngine::MinimizedDFA: return "min-dfa";
+    }
+    return "?";
+}
+
+bool parseEngineName(const string& name, MatchEngine& engine) {
+    for (MatchEngine candidate : { MatchEngine::BitParallel, MatchEngine::NFASimulation,
+        MatchEngine::LazyDFA, MatchEngine::DFA, MatchEngine::MinimizedDFA })
+        if (engineName(candidate) == name) {
+            engine = candidate;
+            return true;
+        }
+    return false;
+}
+
+void MatchPlan::print(ostream& os) const {
+    os << "Motor: " << engineName(engine) << " (" << reason << ")" << endl
+        << "  stari AFN: " << nfaStates << ", alfabet: " << alphabetSize
+        << ", pozitii: " << positions << ", intrare estimata: " << expectedInputBytes << " octeti" << endl;
+    if (dfaStates)
+        os << "  stari AFD: " << dfaStates << endl;
+    os << "  cost estimat: " << estimatedCost << " (constructie " << buildCost
+        << " + " << costPerByte << "/octet)" << endl;
+}
+
+PlannedMatcher::PlannedMatcher(const string& regex, const PlannerOptions& options) {
+    string postfix = toPostfix(insertConcatenation(regex));
+    nfa = regexToNFA_thompson(postfix);
+
+    Node* root = buildSyntaxTree(postfix);
+    plan.positions = BitParallelMatcher::countPositions(root);
+    bool fitsBitParallel = BitParallelMatcher::fits(root);
+    deleteSyntaxTree(root);
+
+    plan.nfaStates = nfa.getQ().size();
+    plan.alphabetSize = nfa.getSigma().size();
+    plan.expectedInputBytes = options.expectedInputBytes;
+
+    MatchEngine engine;
+    size_t maxDfaStates = options.maxDfaStates;
+    if (options.forceEngine) {
+        engine = options.forcedEngine;
+        if (engine == MatchEngine::BitParallel && !fitsBitParallel)
+            throw runtime_error("Motorul bit-parallel accepta cel mult "
+                + to_string(BitParallelMatcher::maxPositions) + " operanzi.");
+        plan.reason = "impus";
+        //motorul cerut explicit se construieste oricat de mare ar iesi AFD-ul, fara alt motor in loc
+        maxDfaStates = SIZE_MAX;
+    }
+    else {
+        //inainte de determinizare presupunem un AFD de marimea automatului Glushkov
+        vector<MatchEngine> alternatives = { MatchEngine::NFASimulation, MatchEngine::LazyDFA };
+        if (fitsBitParallel)
+            alternatives.push_back(MatchEngine::BitParallel);
+        vector<MatchEngine> candidates = alternatives;
+        candidates.push_back(MatchEngine::DFA);
+        candidates.push_back(MatchEngine::MinimizedDFA);
+
+        double guess = plan.positions + 1.0;
+        engine = cheapest(candidates, plan, guess, guess * minimizedShrink);
+        plan.reason = "cost minim estimat";
+
+        //estimarea poate fi mult prea optimista (explozie la determinizare): oprim constructia
+        //cand ar costa mai mult decat cea mai buna alternativa fara AFD complet
+        if (engine == MatchEngine::DFA || engine == MatchEngine::MinimizedDFA) {
+            MatchEngine alternative = cheapest(alternatives, plan, guess, guess);
+            CostEstimate alternativeCost = estimate(alternative, plan, guess, guess);
+            CostEstimate perState = estimate(MatchEngine::DFA, plan, 1, 1);
+            double budget = (alternativeCost.build + (alternativeCost.perByte - perState.perByte)
+                * (double)plan.expectedInputBytes) / perState.build;
+            if (budget < (double)maxDfaStates)
+                maxDfaStates = (size_t)max(budget, guess);
+        }
+    }
+
+    build(engine, postfix, options, maxDfaStates);
+}
+
+void PlannedMatcher::build(MatchEngine engine, const string& postfix, const PlannerOptions& options, size_t maxDfaStates) {
+    if (engine == MatchEngine::DFA || engine == MatchEngine::MinimizedDFA) {
+        if (!nfa.tryConvertToDFA(dfa, maxDfaStates)) {
+            //expresie patologica: nu platim determinizarea completa
+            plan.reason += "; AFD-ul depaseste " + to_string(maxDfaStates) + " stari";
+            vector<MatchEngine> fallback = { MatchEngine::LazyDFA, MatchEngine::NFASimulation };
+            if (plan.positions > 0 && plan.positions <= BitParallelMatcher::maxPositions)
+                fallback.push_back(MatchEngine::BitParallel);
+            //marimea reala e necunoscuta: presupunem ca AFD-ul lenes isi umple tot cache-ul
+            double states = (double)max(maxDfaStates, LazyDeterministicAutomaton::defaultMaxCachedStates);
+            MatchEngine next = cheapest(fallback, plan, states, states);
+            dfa = DeterministicFiniteAutomaton();
+            build(next, postfix, options, maxDfaStates);
+            applyEstimate(plan, next, states, states);
+            return;
+        }
+
+        //acum stim numarul real de stari si putem compara corect cu minimizarea
+        double states = (double)dfa.getQ().size();
+        if (!options.forceEngine)
+            engine = cheapest({ MatchEngine::DFA, MatchEngine::MinimizedDFA }, plan, states, states * minimizedShrink);
+        if (engine == MatchEngine::MinimizedDFA)
+            dfa = dfa.minimize();
+        plan.dfaStates = dfa.getQ().size();
+        applyEstimate(plan, engine, states, (double)plan.dfaStates);
+        return;
+    }
+
+    if (engine == MatchEngine::BitParallel) {
+        Node* root = buildSyntaxTree(postfix);
+        bit_parallel = make_unique<BitParallelMatcher>(root);
+        deleteSyntaxTree(root);
+    }
+    else if (engine == MatchEngine::LazyDFA)
+        lazy_dfa = make_unique<LazyDeterministicAutomaton>(std::move(nfa));
+    double guess = plan.positions + 1.0;
+    applyEstimate(plan, engine, guess, guess);
+}
+
+bool PlannedMatcher::checkWord(const string& word) const {
+    switch (plan.engine) {
+    case MatchEngine::BitParallel:
+        return bit_parallel->checkWord(word);
+    case MatchEngine::NFASimulation:
+        return nfa.checkWord(word);
+    case MatchEngine::LazyDFA:
+        return lazy_dfa->checkWord(word);
+    default:
+        return dfa.checkWord(word);
+    }
+}
+
+const MatchPlan& PlannedMatcher::getPlan() const {
+    return plan;
+}
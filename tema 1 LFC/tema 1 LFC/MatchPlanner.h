@@ -0,0 +1,66 @@
+#pragma once
+#include <iostream>
+#include <memory>
+#include <string>
+#include "BitParallelMatcher.h"
+#include "DeterministicFiniteAutomaton.h"
+#include "LazyDeterministicAutomaton.h"
+#include "NondeterministicFiniteAutomaton.h"
+
+using namespace std;
+
+enum class MatchEngine {
+    BitParallel,      // Glushkov pe un uint64_t, fara determinizare
+    NFASimulation,    // move/lambdaClosure direct pe AFN
+    LazyDFA,          // subseturi calculate la cerere, cache marginit
+    DFA,              // convertToDFA complet, tabel dens/comprimat
+    MinimizedDFA      // convertToDFA + Hopcroft
+};
+
+string engineName(MatchEngine engine);
+// accepta numele intoarse de engineName; false pentru un nume necunoscut
+bool parseEngineName(const string& name, MatchEngine& engine);
+
+struct PlannerOptions {
+    size_t expectedInputBytes = 1 << 20;   // cat text va fi verificat cu expresia
+    size_t maxDfaStates = 10000;           // peste aceasta limita determinizarea completa e abandonata
+    bool forceEngine = false;              // forcedEngine e construit oricum, fara limita de stari
+    MatchEngine forcedEngine = MatchEngine::DFA;
+};
+
+// planul ales si datele pe care s-a bazat; costurile sunt in operatii elementare estimate
+struct MatchPlan {
+    MatchEngine engine = MatchEngine::DFA;
+    double estimatedCost = 0;     // constructie + parcurgerea intrarii asteptate
+    double buildCost = 0;
+    double costPerByte = 0;
+    size_t nfaStates = 0;
+    size_t alphabetSize = 0;
+    int positions = 0;            // operanzii expresiei (pozitiile Glushkov)
+    size_t expectedInputBytes = 0;
+    size_t dfaStates = 0;         // 0 daca nu s-a construit un AFD complet
+    string reason;
+
+    void print(ostream& os) const;
+};
+
+// alege motorul cel mai ieftin pentru expresie si volumul de intrare, apoi il construieste;
+// daca AFD-ul complet depaseste maxDfaStates (sau bugetul dat de cea mai buna alternativa)
+// se trece pe AFD lenes, bit-paralel sau simularea AFN (doar cand motorul nu e impus)
+class PlannedMatcher
+{
+private:
+    MatchPlan plan;
+    NondeterministicFiniteAutomaton nfa;
+    DeterministicFiniteAutomaton dfa;
+    unique_ptr<BitParallelMatcher> bit_parallel;
+    unique_ptr<LazyDeterministicAutomaton> lazy_dfa;
+
+    void build(MatchEngine engine, const string& postfix, const PlannerOptions& options, size_t maxDfaStates);
+
+public:
+    explicit PlannedMatcher(const string& regex, const PlannerOptions& options = PlannerOptions());
+
+    bool checkWord(const string& word) const;
+    const MatchPlan& getPlan() const;
+};
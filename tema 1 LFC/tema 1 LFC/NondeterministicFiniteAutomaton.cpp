@@ -1,5 +1,6 @@
 ﻿#include "NondeterministicFiniteAutomaton.h"
 #include <algorithm>
+#include <cstdint>
 #include <stdexcept>
 #include <queue>
 
@@ -35,12 +36,12 @@ void NondeterministicFiniteAutomaton::setF(const set<int>& F) {
 	F_finalStates = F;
 }
 
-set<int> NondeterministicFiniteAutomaton::getQ() const
+const set<int>& NondeterministicFiniteAutomaton::getQ() const
 {
     return Q_states;
 }
 
-set<char> NondeterministicFiniteAutomaton::getSigma() const {
+const set<char>& NondeterministicFiniteAutomaton::getSigma() const {
     // includem doar simbolurile de intrare, fara lambda
     return Sigma_alphabet;
 }
@@ -49,10 +50,18 @@ int NondeterministicFiniteAutomaton::getQ0() const {
     return q0_initialState;
 }
 
+const set<int>& NondeterministicFiniteAutomaton::getF() const {
+    return F_finalStates;
+}
+
 const map<pair<int, char>, set<int>>& NondeterministicFiniteAutomaton::getDelta() const {
     return delta_transition;
 }
 
+const map<int, int>& NondeterministicFiniteAutomaton::getTags() const {
+    return state_tags;
+}
+
 void NondeterministicFiniteAutomaton::addState(int state) {
     Q_states.insert(state);
 }
@@ -67,6 +76,11 @@ void NondeterministicFiniteAutomaton::addFinalState(int state) {
     F_finalStates.insert(state);
 }
 
+void NondeterministicFiniteAutomaton::addTag(int state, int tag) {
+    Q_states.insert(state);
+    state_tags[state] = tag;
+}
+
 void NondeterministicFiniteAutomaton::addSymbol(char symbol) {
     if (symbol != lambda)
         Sigma_alphabet.insert(symbol);
@@ -120,6 +134,8 @@ static map<int, int> mergeWithOffset(NondeterministicFiniteAutomaton& result, co
     }
 	//copiem alfabetul fara lambda
     for (char s : other.getSigma()) result.addSymbol(s);
+    for (const auto& tag : other.getTags())
+        result.addTag(mapping.at(tag.first), tag.second);
 
     return mapping;
 }
@@ -136,7 +152,7 @@ NondeterministicFiniteAutomaton NondeterministicFiniteAutomaton::createBasicNFA(
     return nfa;
 }
 
-NondeterministicFiniteAutomaton NondeterministicFiniteAutomaton::combineConcatenation(const NondeterministicFiniteAutomaton& other) const { //leaga starea finala a primului nfa la starea init a urmat nfa  op .
+NondeterministicFiniteAutomaton NondeterministicFiniteAutomaton::combineConcatenation(const NondeterministicFiniteAutomaton& other) const& { //leaga starea finala a primului nfa la starea init a urmat nfa  op .
    
     //validam starea finala pt ambele
     if (this->F_finalStates.size() != 1 || other.F_finalStates.size() != 1)
@@ -169,11 +185,21 @@ NondeterministicFiniteAutomaton NondeterministicFiniteAutomaton::combineConcaten
     return result;
 }
 
-NondeterministicFiniteAutomaton NondeterministicFiniteAutomaton::combineKleeneStar() const { //op *
+NondeterministicFiniteAutomaton NondeterministicFiniteAutomaton::combineKleeneStar() const& {
+    NondeterministicFiniteAutomaton copy = *this;
+    return std::move(copy).combineKleeneStar();
+}
+
+NondeterministicFiniteAutomaton NondeterministicFiniteAutomaton::combinePlus() const& {
+    NondeterministicFiniteAutomaton copy = *this;
+    return std::move(copy).combinePlus();
+}
+
+NondeterministicFiniteAutomaton NondeterministicFiniteAutomaton::combineKleeneStar() && { //op *
     if (this->q0_initialState == -1 || this->F_finalStates.empty())
         throw std::runtime_error("NFA must be initialized for Kleene Star operation.");
 
-    NondeterministicFiniteAutomaton result = *this; // copia A
+    NondeterministicFiniteAutomaton& result = *this; // A, modificat pe loc
 
     int iA = this->q0_initialState;
     int fA = *this->F_finalStates.begin();
@@ -198,14 +224,14 @@ NondeterministicFiniteAutomaton NondeterministicFiniteAutomaton::combineKleeneSt
     result.addTransition(fA, lambda, iA);
     result.addTransition(fA, lambda, fC);
 
-    return result;
+    return std::move(result);
 }
 
-NondeterministicFiniteAutomaton NondeterministicFiniteAutomaton::combinePlus() const { //op +
+NondeterministicFiniteAutomaton NondeterministicFiniteAutomaton::combinePlus() && { //op +
     if (this->q0_initialState == -1 || this->F_finalStates.empty())
         throw std::runtime_error("NFA must be initialized for Plus operation.");
 
-    NondeterministicFiniteAutomaton result = *this;
+    NondeterministicFiniteAutomaton& result = *this;
 
     int iA = this->q0_initialState;
     int fA = *this->F_finalStates.begin();
@@ -224,10 +250,37 @@ NondeterministicFiniteAutomaton NondeterministicFiniteAutomaton::combinePlus() c
     result.addTransition(fA, lambda, fC);
     result.addTransition(fA, lambda, iA);
 
-    return result;
+    return std::move(result);
 }
 
-NondeterministicFiniteAutomaton NondeterministicFiniteAutomaton::combineUnion(const NondeterministicFiniteAutomaton& other) const { //op |
+NondeterministicFiniteAutomaton NondeterministicFiniteAutomaton::combineGroup(int group) const& {
+    NondeterministicFiniteAutomaton copy = *this;
+    return std::move(copy).combineGroup(group);
+}
+
+NondeterministicFiniteAutomaton NondeterministicFiniteAutomaton::combineGroup(int group) && { //grup ( )
+    if (this->q0_initialState == -1 || this->F_finalStates.size() != 1)
+        throw std::runtime_error("NFA must be initialized for group operation.");
+
+    int iA = this->q0_initialState;
+    int fA = *this->F_finalStates.begin();
+
+    int open = allocateStateIndex();
+    int close = allocateStateIndex();
+    addTag(open, 2 * group);
+    addTag(close, 2 * group + 1);
+
+    F_finalStates.clear();
+    setInitialState(open);
+    addFinalState(close);
+
+    addTransition(open, lambda, iA);
+    addTransition(fA, lambda, close);
+
+    return std::move(*this);
+}
+
+NondeterministicFiniteAutomaton NondeterministicFiniteAutomaton::combineUnion(const NondeterministicFiniteAutomaton& other) const& { //op |
     if (this->F_finalStates.size() != 1 || other.F_finalStates.size() != 1)
         throw std::runtime_error("Both NFAs must have exactly one final state for union.");
 
@@ -259,6 +312,68 @@ NondeterministicFiniteAutomaton NondeterministicFiniteAutomaton::combineUnion(co
     return result;
 }
 
+//muta starile, alfabetul si tranzitiile lui other in automatul curent; iB si fB primesc
+//starea initiala si cea finala a lui other, cu indicii din automatul curent
+void NondeterministicFiniteAutomaton::absorb(NondeterministicFiniteAutomaton&& other, int& iB, int& fB) {
+    //fragmentele Thompson au indici unici (next_state_index), deci de obicei intervalele sunt disjuncte
+    //si nodurile pot fi mutate direct; altfel revenim la reindexare
+    bool disjoint = Q_states.empty() || other.Q_states.empty()
+        || *Q_states.rbegin() < *other.Q_states.begin() || *other.Q_states.rbegin() < *Q_states.begin();
+
+    if (!disjoint) {
+        map<int, int> mapping = mergeWithOffset(*this, other);
+        iB = mapping.at(other.q0_initialState);
+        fB = mapping.at(*other.F_finalStates.begin());
+        return;
+    }
+
+    iB = other.q0_initialState;
+    fB = *other.F_finalStates.begin();
+    Q_states.merge(other.Q_states);
+    Sigma_alphabet.merge(other.Sigma_alphabet);
+    delta_transition.merge(other.delta_transition);
+    state_tags.merge(other.state_tags);
+}
+
+NondeterministicFiniteAutomaton NondeterministicFiniteAutomaton::combineConcatenation(NondeterministicFiniteAutomaton&& other) && {
+    if (this->F_finalStates.size() != 1 || other.F_finalStates.size() != 1)
+        throw std::runtime_error("Both NFAs must have exactly one final state for concatenation.");
+
+    int fA = *F_finalStates.begin();
+    int iB, fB;
+    absorb(std::move(other), iB, fB);
+
+    //starea finala a lui A se leaga prin lambda de starea initiala a lui B
+    F_finalStates.clear();
+    addTransition(fA, lambda, iB);
+    addFinalState(fB);
+
+    return std::move(*this);
+}
+
+NondeterministicFiniteAutomaton NondeterministicFiniteAutomaton::combineUnion(NondeterministicFiniteAutomaton&& other) && {
+    if (this->F_finalStates.size() != 1 || other.F_finalStates.size() != 1)
+        throw std::runtime_error("Both NFAs must have exactly one final state for union.");
+
+    int iA = q0_initialState;
+    int fA = *F_finalStates.begin();
+    int iB, fB;
+    absorb(std::move(other), iB, fB);
+
+    int newInitial = allocateStateIndex();
+    int newFinal = allocateStateIndex();
+    F_finalStates.clear();
+    setInitialState(newInitial);
+    addFinalState(newFinal);
+
+    addTransition(newInitial, lambda, iA);
+    addTransition(newInitial, lambda, iB);
+    addTransition(fA, lambda, newFinal);
+    addTransition(fB, lambda, newFinal);
+
+    return std::move(*this);
+}
+
 
 set<int> NondeterministicFiniteAutomaton::lambdaClosure(const set<int>& states) const {
     set<int> closure = states; 
@@ -304,9 +419,30 @@ set<int> NondeterministicFiniteAutomaton::move(const set<int>& states, char symb
 }
 
 
+bool NondeterministicFiniteAutomaton::checkWord(const string& word) const {
+    if (q0_initialState == -1)
+        return false;
+
+    set<int> current = lambdaClosure({ q0_initialState });
+    for (char symbol : word) {
+        current = lambdaClosure(move(current, symbol));
+        if (current.empty())
+            return false;
+    }
+
+    for (int state : current)
+        if (F_finalStates.count(state))
+            return true;
+    return false;
+}
+
 DeterministicFiniteAutomaton NondeterministicFiniteAutomaton::convertToDFA() const {
     DeterministicFiniteAutomaton DFA;
+    tryConvertToDFA(DFA, SIZE_MAX);
+    return DFA;
+}
 
+bool NondeterministicFiniteAutomaton::tryConvertToDFA(DeterministicFiniteAutomaton& DFA, size_t maxStates) const {
     if (q0_initialState == -1) 
         throw std::runtime_error("ConvertToDFA error: stare initiala neinitializata (q0 = -1).");
     if (Sigma_alphabet.empty())
@@ -362,6 +498,8 @@ DeterministicFiniteAutomaton NondeterministicFiniteAutomaton::convertToDFA() con
             if (dfa_states_map.count(target_dfa_set))
                 target_dfa_state = dfa_states_map.at(target_dfa_set);
             else {
+                if (dfa_states_map.size() >= maxStates)
+                    return false;
                 target_dfa_state = dfa_next_state_index;
                 dfa_states_map[target_dfa_set] = target_dfa_state;
                 dfa_q_states.insert(target_dfa_state);
@@ -377,8 +515,9 @@ DeterministicFiniteAutomaton NondeterministicFiniteAutomaton::convertToDFA() con
     DFA.setSigma(Sigma_alphabet);
     DFA.setDelta(dfa_delta);
     DFA.setF(dfa_f_states);
+    DFA.pruneDeadStates();
 
-    return DFA;
+    return true;
 }
 
 void NondeterministicFiniteAutomaton::printNFA(ostream& os) const {
@@ -459,4 +598,3 @@ void NondeterministicFiniteAutomaton::printNFA(ostream& os) const {
     }
     os << "=======================================" << endl;
 }
-
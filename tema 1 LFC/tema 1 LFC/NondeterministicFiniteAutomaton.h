@@ -3,6 +3,7 @@
 #include <map>
 #include <stack>
 #include <iostream>
+#include <string>
 #include "DeterministicFiniteAutomaton.h"
 
 using namespace std;
@@ -17,6 +18,9 @@ private:
 	map<pair<int, char>, set<int>> delta_transition;
 	int q0_initialState;                           
 	set<int> F_finalStates;
+	map<int, int> state_tags;   // starea -> eticheta (inceput/sfarsit de grup) pusa cand e atinsa
+
+	void absorb(NondeterministicFiniteAutomaton&& other, int& iB, int& fB);
 
 public: 
 	static int next_state_index;
@@ -29,29 +33,50 @@ public:
 	void setQ0(int q0);
 	void setF(const set<int>& F);
 
-	set<int> getQ() const;
-	set<char> getSigma() const;
+	const set<int>& getQ() const;
+	const set<char>& getSigma() const;
 	int getQ0() const;
+	const set<int>& getF() const;
 	const map<pair<int, char>, set<int>>& getDelta() const;
+	const map<int, int>& getTags() const;
 
 	void addState(int state);
 	void addTransition(int from, char symbol, int to);
 	void addSymbol(char symbol);
 	void setInitialState(int state);
 	void addFinalState(int state);
+	void addTag(int state, int tag);
 
 	set<int> lambdaClosure(const set<int>& states) const;
 	set<int> move(const set<int>& states, char symbol) const;
 
 	static NondeterministicFiniteAutomaton createBasicNFA(char symbol);
 
-	NondeterministicFiniteAutomaton combineUnion(const NondeterministicFiniteAutomaton& other) const;     // Operator '|'
-	NondeterministicFiniteAutomaton combineConcatenation(const NondeterministicFiniteAutomaton& other) const; // Operator '.'
-	NondeterministicFiniteAutomaton combineKleeneStar() const;                                           // Operator '*'
-	NondeterministicFiniteAutomaton combinePlus() const;                                                 // Operator '+'
+	// variantele const& lasa operanzii neschimbati si intorc o copie reindexata
+	NondeterministicFiniteAutomaton combineUnion(const NondeterministicFiniteAutomaton& other) const&;     // Operator '|'
+	NondeterministicFiniteAutomaton combineConcatenation(const NondeterministicFiniteAutomaton& other) const&; // Operator '.'
+	NondeterministicFiniteAutomaton combineKleeneStar() const&;                                           // Operator '*'
+	NondeterministicFiniteAutomaton combinePlus() const&;                                                 // Operator '+'
+
+	// variantele && modifica automatul pe loc si muta nodurile lui other fara copiere
+	// (ex: std::move(nfa).combineKleeneStar()); se aloca doar starile si tranzitiile noi
+	NondeterministicFiniteAutomaton combineUnion(NondeterministicFiniteAutomaton&& other) &&;
+	NondeterministicFiniteAutomaton combineConcatenation(NondeterministicFiniteAutomaton&& other) &&;
+	NondeterministicFiniteAutomaton combineKleeneStar() &&;
+	NondeterministicFiniteAutomaton combinePlus() &&;
+
+	// grupul group (numerotat de la 0) inconjoara automatul cu doua stari etichetate:
+	// 2*group la intrare si 2*group+1 la iesire
+	NondeterministicFiniteAutomaton combineGroup(int group) const&;
+	NondeterministicFiniteAutomaton combineGroup(int group) &&;
+
+	// simulare directa cu move/lambdaClosure, fara determinizare
+	bool checkWord(const string& word) const;
 
 	void printNFA(ostream& os) const;
 	DeterministicFiniteAutomaton convertToDFA() const;
+	// ca convertToDFA, dar renunta (intoarce false) cand AFD-ul depaseste maxStates stari
+	bool tryConvertToDFA(DeterministicFiniteAutomaton& result, size_t maxStates) const;
 
 
 };
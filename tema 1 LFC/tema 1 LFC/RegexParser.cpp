@@ -0,0 +1,209 @@
+#include "RegexParser.h"
+#include <stack>
+#include <stdexcept>
+
+bool isOperand(char c) { return isalnum((unsigned char)c); }
+bool isUnaryOperator(char c) { return c == '*' || c == '+'; }
+
+namespace {
+    //orice alt caracter decat operanzii, parantezele si . | * + este o eroare, nu un operator
+    void checkOperator(char c) {
+        if (c != '.' && c != '|' && !isUnaryOperator(c))
+            throw runtime_error(string("Expresie regulata invalida: caracter neasteptat '") + c + "'.");
+    }
+}
+
+
+//inserare concatenare explicita -> adaug . 
+string insertConcatenation(const string& regex) 
+{
+    string processed = "";
+    for (size_t i = 0; i < regex.length(); ++i) {
+        char curr = regex[i];
+        processed += curr;
+        if (i + 1 < regex.length()) 
+        {
+            char next = regex[i + 1];
+            bool left = isOperand(curr) || curr == ')' || isUnaryOperator(curr);
+            bool right = isOperand(next) || next == '(';
+            if (left && right) 
+                processed += '.';
+        }
+    }
+    return processed;
+}
+
+int priority(char op) 
+{
+    switch (op) {
+    case '*': case '+': return 3;
+    case '.': return 2;
+    case '|': return 1;
+    default: return 0;
+    }
+}
+
+NondeterministicFiniteAutomaton regexToNFA_thompson(const string& postfix, const vector<int>& groupNumbers)
+{
+    stack<NondeterministicFiniteAutomaton> nfaStack;
+    size_t nextGroup = 0;
+    for (char c : postfix) {
+        size_t operands = (c == '.' || c == '|') ? 2 : (isUnaryOperator(c) || c == ')') ? 1 : 0;
+        if (nfaStack.size() < operands)
+            throw runtime_error(string("Expresie regulata invalida: operand lipsa pentru '") + c + "'.");
+
+        if (isalnum((unsigned char)c))
+            nfaStack.push(NondeterministicFiniteAutomaton::createBasicNFA(c));
+        else if (c == '.') {
+            NondeterministicFiniteAutomaton NFA2 = std::move(nfaStack.top()); nfaStack.pop();
+            NondeterministicFiniteAutomaton NFA1 = std::move(nfaStack.top()); nfaStack.pop();
+            nfaStack.push(std::move(NFA1).combineConcatenation(std::move(NFA2)));
+        }
+        else if (c == '|') {
+            NondeterministicFiniteAutomaton NFA2 = std::move(nfaStack.top()); nfaStack.pop();
+            NondeterministicFiniteAutomaton NFA1 = std::move(nfaStack.top()); nfaStack.pop();
+            nfaStack.push(std::move(NFA1).combineUnion(std::move(NFA2)));
+        }
+        else if (c == '*') {
+            //fragmentul din varful stivei e modificat pe loc
+            nfaStack.top() = std::move(nfaStack.top()).combineKleeneStar();
+        }
+        else if (c == '+') {
+            nfaStack.top() = std::move(nfaStack.top()).combinePlus();
+        }
+        else if (c == ')' && nextGroup < groupNumbers.size()) {
+            //sfarsit de grup (doar in forma produsa de toPostfixWithGroups)
+            nfaStack.top() = std::move(nfaStack.top()).combineGroup(groupNumbers[nextGroup++]);
+        }
+        else
+            throw runtime_error(string("Expresie regulata invalida: caracter neasteptat '") + c + "'.");
+    }
+
+    if (nfaStack.empty())
+        throw runtime_error("Expresie regulata invalida sau goala.");
+    //fragmentele ramase nu ar fi legate de rezultat (de ex. un operator necunoscut intre ele)
+    if (nfaStack.size() > 1)
+        throw runtime_error("Expresie regulata invalida: operator lipsa intre fragmente.");
+
+    return std::move(nfaStack.top());
+}
+
+namespace {
+    //algoritmul shunting-yard comun; daca groupNumbers e dat, fiecare grup inchis lasa un ')'
+    //in postfix, iar groupNumbers[k] este numarul (in ordinea parantezelor deschise, de la 0)
+    //grupului inchis de al k-lea ')'
+    string shuntingYard(const string& regex, vector<int>* groupNumbers)
+    {
+        stack<char> operators;
+        stack<int> openGroups;
+        int groupCount = 0;
+        string out;
+        if (groupNumbers)
+            groupNumbers->clear();
+        for (char c : regex) {
+            if (isOperand(c))
+                out += c;
+            else if (c == '(') {
+                operators.push(c);
+                openGroups.push(groupCount++);
+            }
+            else if (c == ')')
+            {
+                while (!operators.empty() && operators.top() != '(')
+                {
+                    out += operators.top();
+                    operators.pop();
+                }
+                if (operators.empty())
+                    throw runtime_error("Expresie regulata invalida: ')' fara '(' pereche.");
+                operators.pop();
+                if (groupNumbers) {
+                    out += ')';
+                    groupNumbers->push_back(openGroups.top());
+                }
+                openGroups.pop();
+            }
+            else {
+                checkOperator(c);
+                while (!operators.empty() && priority(operators.top()) >= priority(c)) {
+                    out += operators.top();
+                    operators.pop();
+                }
+                operators.push(c);
+            }
+        }
+        while (!operators.empty()) {
+            if (operators.top() == '(')
+                throw runtime_error("Expresie regulata invalida: '(' fara ')' pereche.");
+            out += operators.top();
+            operators.pop();
+        }
+        return out;
+    }
+}
+
+//regex in postfix
+string toPostfix(const string& regex) 
+{
+    return shuntingYard(regex, nullptr);
+}
+
+//ca toPostfix, dar pastreaza grupurile ca ')' in postfix
+string toPostfixWithGroups(const string& regex, vector<int>& groupNumbers)
+{
+    return shuntingYard(regex, &groupNumbers);
+}
+
+DeterministicFiniteAutomaton RegexToDFA(const string& regex) {
+    string processed_regex = insertConcatenation(regex);
+    string postfix_r = toPostfix(processed_regex);
+    NondeterministicFiniteAutomaton NFA = regexToNFA_thompson(postfix_r);
+    return NFA.convertToDFA();
+}
+
+TaggedDeterministicAutomaton RegexToTaggedDFA(const string& regex) {
+    vector<int> groupNumbers;
+    string postfix = toPostfixWithGroups(insertConcatenation(regex), groupNumbers);
+    NondeterministicFiniteAutomaton NFA = regexToNFA_thompson(postfix, groupNumbers);
+    return TaggedDeterministicAutomaton(NFA, (int)groupNumbers.size());
+}
+
+Node* buildSyntaxTree(const string& postfix) {
+    stack<Node*> st;
+    auto fail = [&st](const string& message) {
+        while (!st.empty()) {
+            deleteSyntaxTree(st.top());
+            st.pop();
+        }
+        throw runtime_error("Expresie regulata invalida: " + message);
+    };
+
+    for (char c : postfix) {
+        if (isalnum(c)) st.push(new Node(c));
+        else if (isUnaryOperator(c)) {
+            if (st.empty())
+                fail(string("operand lipsa pentru '") + c + "'.");
+            Node* a = st.top(); st.pop();
+            st.push(new Node(c, a));
+        }
+        else { // operatori binari: . |
+            if (st.size() < 2)
+                fail(string("operand lipsa pentru '") + c + "'.");
+            Node* b = st.top(); st.pop();
+            Node* a = st.top(); st.pop();
+            st.push(new Node(c, a, b));
+        }
+    }
+    //mai multe noduri ramase = fragmente nelegate intre ele; nu le pierdem in memorie
+    if (st.size() > 1)
+        fail("operator lipsa intre fragmente.");
+    return st.empty() ? nullptr : st.top();
+}
+
+void deleteSyntaxTree(Node* root) {
+    if (!root)
+        return;
+    deleteSyntaxTree(root->left);
+    deleteSyntaxTree(root->right);
+    delete root;
+}
@@ -0,0 +1,33 @@
+#pragma once
+#include <string>
+#include <vector>
+#include "DeterministicFiniteAutomaton.h"
+#include "NondeterministicFiniteAutomaton.h"
+#include "TaggedDeterministicAutomaton.h"
+
+using namespace std;
+
+//nod arbore sintactic
+struct Node {
+    char value;
+    Node* left;
+    Node* right;
+    Node(char v, Node* l = nullptr, Node* r = nullptr)
+        : value(v), left(l), right(r) {
+    }
+};
+
+bool isOperand(char c);
+bool isUnaryOperator(char c);
+int priority(char op);
+
+string insertConcatenation(const string& regex);  // adauga '.' explicit
+string toPostfix(const string& regex);             // forma poloneza postfixata
+string toPostfixWithGroups(const string& regex, vector<int>& groupNumbers);  // pastreaza grupurile ca ')'
+
+NondeterministicFiniteAutomaton regexToNFA_thompson(const string& postfix, const vector<int>& groupNumbers = {});
+DeterministicFiniteAutomaton RegexToDFA(const string& regex);
+TaggedDeterministicAutomaton RegexToTaggedDFA(const string& regex);   // grupurile devin subpotriviri
+
+Node* buildSyntaxTree(const string& postfix);
+void deleteSyntaxTree(Node* root);
@@ -1,14 +1,20 @@
 ﻿#include "DeterministicFiniteAutomaton.h"
 #include "NondeterministicFiniteAutomaton.h"
+#include "RegexParser.h"
+#include "CommandLine.h"
 #include <iostream>
 #include <stack>
-#include <windows.h>
 #include <fstream>
 #include <algorithm>
+#ifdef _WIN32
+#include <windows.h>
+#endif
 
 using namespace std;
 
+#ifdef _WIN32
 HANDLE hConsole = GetStdHandle(STD_OUTPUT_HANDLE);
+#endif
 
 #define COLOR_DEFAULT 7  
 #define COLOR_BLUE 9
@@ -19,143 +25,13 @@ HANDLE hConsole = GetStdHandle(STD_OUTPUT_HANDLE);
 #define COLOR_BOLD 8
 #define COLOR_PINK 13
 
-//nod arbore sintactic
-struct Node {
-    char value;
-    Node* left;
-    Node* right;
-    Node(char v, Node* l = nullptr, Node* r = nullptr)
-        : value(v), left(l), right(r) {
-    }
-};
-
-bool isOperand(char c) { return isalnum((unsigned char)c); }
-bool isUnaryOperator(char c) { return c == '*' || c == '+'; }
-
-
-//inserare concatenare explicita -> adaug . 
-string insertConcatenation(const string& regex) 
-{
-    string processed = "";
-    for (size_t i = 0; i < regex.length(); ++i) {
-        char curr = regex[i];
-        processed += curr;
-        if (i + 1 < regex.length()) 
-        {
-            char next = regex[i + 1];
-            bool left = isOperand(curr) || curr == ')' || isUnaryOperator(curr);
-            bool right = isOperand(next) || next == '(';
-            if (left && right) 
-                processed += '.';
-        }
-    }
-    return processed;
-}
-
 void setConsoleColor(int color) 
 {
+#ifdef _WIN32
     SetConsoleTextAttribute(hConsole, color);
-}
-
-int priority(char op) 
-{
-    switch (op) {
-    case '*': case '+': return 3;
-    case '.': return 2;
-    case '|': return 1;
-    default: return 0;
-    }
-}
-
-NondeterministicFiniteAutomaton regexToNFA_thompson(const string& postfix)
-{
-    stack<NondeterministicFiniteAutomaton> nfaStack;
-    for (char c : postfix) {
-        if (isalnum((unsigned char)c))
-            nfaStack.push(NondeterministicFiniteAutomaton::createBasicNFA(c));
-        else if (c == '.') {
-            NondeterministicFiniteAutomaton NFA2 = nfaStack.top(); nfaStack.pop();
-            NondeterministicFiniteAutomaton NFA1 = nfaStack.top(); nfaStack.pop();
-            nfaStack.push(NFA1.combineConcatenation(NFA2));
-        }
-        else if (c == '|') {
-            NondeterministicFiniteAutomaton NFA2 = nfaStack.top(); nfaStack.pop();
-            NondeterministicFiniteAutomaton NFA1 = nfaStack.top(); nfaStack.pop();
-            nfaStack.push(NFA1.combineUnion(NFA2));
-        }
-        else if (c == '*') {
-            NondeterministicFiniteAutomaton NFA1 = nfaStack.top(); nfaStack.pop();
-            nfaStack.push(NFA1.combineKleeneStar());
-        }
-        else if (c == '+') {
-            NondeterministicFiniteAutomaton NFA1 = nfaStack.top(); nfaStack.pop();
-            nfaStack.push(NFA1.combinePlus());
-        }
-    }
-
-    if (nfaStack.empty())
-        throw runtime_error("Expresie regulata invalida sau goala.");
-
-    return nfaStack.top();
-}
-
-//regex in postfix
-string toPostfix(const string& regex) 
-{
-    stack<char> operators;
-    string out;
-    for (char c : regex) {
-        if (isOperand(c)) 
-            out += c;
-        else if (c == '(') 
-            operators.push(c);
-        else if (c == ')') 
-        {
-            while (!operators.empty() && operators.top() != '(') 
-            {
-                out += operators.top();
-                operators.pop();
-            }
-            if (!operators.empty()) 
-                operators.pop();
-        }
-        else {
-            while (!operators.empty() && priority(operators.top()) >= priority(c)) {
-                out += operators.top();
-                operators.pop();
-            }
-            operators.push(c);
-        }
-    }
-    while (!operators.empty()) {
-        out += operators.top();
-        operators.pop();
-    }
-    return out;
-}
-
-DeterministicFiniteAutomaton RegexToDFA(const string& regex) {
-    string processed_regex = insertConcatenation(regex);
-    string postfix_r = toPostfix(processed_regex);
-    NondeterministicFiniteAutomaton NFA = regexToNFA_thompson(postfix_r);
-    return NFA.convertToDFA();
-}
-
-Node* buildSyntaxTree(const string& postfix) {
-    stack<Node*> st;
-    for (char c : postfix) {
-        if (isalnum(c)) st.push(new Node(c));
-        else if (isUnaryOperator(c)) {
-            Node* a = st.top(); st.pop();
-            st.push(new Node(c, a));
-        }
-        else { // operatori binari: . |
-            Node* b = st.top(); st.pop();
-            Node* a = st.top(); st.pop();
-            st.push(new Node(c, a, b));
-        }
-    }
-    return st.empty() ? nullptr : st.top();
+#else
+    (void)color; // culorile sunt disponibile doar in consola Windows
+#endif
 }
 
 void printSyntaxTree(Node* root, string indent = "", bool last = true) {
@@ -181,32 +57,49 @@ void printSyntaxTree(Node* root, string indent = "", bool last = true) {
     }
 }
 
-int main()
+int runInteractiveMenu(const CommandLineOptions& options)
 {
     string regex_r;
-    ifstream inFile("regexInput.txt");
-    if (inFile.is_open()) {
-        getline(inFile, regex_r);
-        inFile.close();
-        regex_r.erase(remove(regex_r.begin(), regex_r.end(), '\n'), regex_r.end());
-        cout << "Expresia regulata citita: " << regex_r << endl;
+    if (options.regexGiven) {
+        regex_r = options.regex;
+        cout << "Expresia regulata: " << regex_r << endl;
     }
     else {
-        cout << "Fisierul nu exista, folosim valoare implicita: a+b" << endl;
-        regex_r = "a+b";
+        ifstream inFile("regexInput.txt");
+        if (inFile.is_open()) {
+            getline(inFile, regex_r);
+            inFile.close();
+            regex_r.erase(remove(regex_r.begin(), regex_r.end(), '\n'), regex_r.end());
+            cout << "Expresia regulata citita: " << regex_r << endl;
+        }
+        else {
+            cout << "Fisierul nu exista, folosim valoare implicita: a+b" << endl;
+            regex_r = "a+b";
+        }
     }
 
     cout << "---------------------------------------" << endl;
 
-    string processed_regex = insertConcatenation(regex_r);
-    string postfix_r = toPostfix(processed_regex);
-
-    DeterministicFiniteAutomaton AFD = RegexToDFA(regex_r);
+    string postfix_r;
+    DeterministicFiniteAutomaton AFD;
+    try {
+        string processed_regex = insertConcatenation(regex_r);
+        postfix_r = toPostfix(processed_regex);
+        AFD = regexToNFA_thompson(postfix_r).convertToDFA();
+    }
+    catch (const exception& e) {
+        cerr << "Eroare: " << e.what() << endl;
+        return 2;
+    }
 
     if (!AFD.verifyAutomaton()) {
         cerr << "ATENTIE: Automat invalid!" << endl;
     }
 
+    //arborele sintactic se construieste o singura data, la prima cerere
+    Node* root = nullptr;
+    bool treeBuilt = false;
+
     int choice;
     string word_to_check;
     setConsoleColor(COLOR_CYAN | COLOR_BOLD);
@@ -218,7 +111,8 @@ int main()
         cout << "4. Verificare cuvant in automat " << endl;
         cout << "0. Iesire" << endl;
         cout << "Alegeti o optiune: ";
-        cin >> choice;
+        if (!(cin >> choice))
+            choice = 0;
         setConsoleColor(COLOR_DEFAULT | COLOR_BOLD);
 
         switch (choice) {
@@ -229,7 +123,10 @@ int main()
             break;
         }
         case 2: {
-            Node* root = buildSyntaxTree(postfix_r);
+            if (!treeBuilt) {
+                root = buildSyntaxTree(postfix_r);
+                treeBuilt = true;
+            }
             setConsoleColor(COLOR_DEFAULT | COLOR_BOLD);
             cout << "\n--- Arbore Sintactic ---" << endl;
             if (root) printSyntaxTree(root);
@@ -269,8 +166,8 @@ int main()
                 cout << " RESPINS ";
                 setConsoleColor(COLOR_DEFAULT | COLOR_BOLD);
                 cout << "de AFD." << endl;
-                break;
             }
+            break;
         case 0:
             cout << "Program incheiat" << endl;
             break;
@@ -280,5 +177,33 @@ int main()
             setConsoleColor(COLOR_CYAN | COLOR_BOLD);
         } while (choice != 0);
 
+        deleteSyntaxTree(root);
         return 0;
     }
+
+int main(int argc, char* argv[])
+{
+    CommandLineOptions options;
+    string error;
+    if (!parseCommandLine(argc, argv, options, error)) {
+        cerr << "Eroare: " << error << endl;
+        printUsage(cerr, argv[0]);
+        return 2;
+    }
+
+    if (options.showHelp) {
+        printUsage(cout, argv[0]);
+        return 0;
+    }
+
+    if (options.interactive)
+        return runInteractiveMenu(options);
+
+    if (options.checkEquivalence)
+        return runEquivalenceCheck(options);
+
+    if (!options.emitFunction.empty())
+        return runCodeGeneration(options);
+
+    return runBatch(options);
+}
@@ -0,0 +1,213 @@
+#include "TaggedDeterministicAutomaton.h"
+#include <algorithm>
+#include <map>
+#include <set>
+#include <stdexcept>
+
+namespace {
+    // un fir al simularii: starea AFN, firul din care provine si etichetele atinse pe drum
+    struct Thread {
+        int state;
+        int origin;
+        vector<int> tags;
+    };
+
+    struct ClosureContext {
+        const NondeterministicFiniteAutomaton& nfa;
+        map<int, vector<int>> lambda_next;   // succesorii lambda, in ordinea indicilor
+        set<int> important;                  // starile cu tranzitii pe simboluri sau finale
+    };
+
+    // inchiderea lambda in ordinea prioritatii: parcurgere in adancime, succesorii in ordinea
+    // indicilor (Thompson aloca ramura stanga si reluarea buclei inaintea iesirii); o stare
+    // deja atinsa de un fir mai prioritar nu mai este revizitata
+    void closure(const ClosureContext& context, int state, int origin, vector<int>& path,
+        set<int>& visited, vector<Thread>& out) {
+        visited.insert(state);
+
+        auto tag = context.nfa.getTags().find(state);
+        if (tag != context.nfa.getTags().end())
+            path.push_back(tag->second);
+
+        if (context.important.count(state))
+            out.push_back({ state, origin, path });
+
+        auto next = context.lambda_next.find(state);
+        if (next != context.lambda_next.end())
+            for (int target : next->second)
+                if (!visited.count(target))
+                    closure(context, target, origin, path, visited, out);
+
+        if (tag != context.nfa.getTags().end())
+            path.pop_back();
+    }
+}
+
+TaggedDeterministicAutomaton::TaggedDeterministicAutomaton(const NondeterministicFiniteAutomaton& nfa,
+    int groupCount, size_t maxStates)
+    : group_count(groupCount), tag_count(2 * groupCount), start_state(-1) {
+    if (nfa.getQ0() == -1)
+        throw runtime_error("TaggedDeterministicAutomaton: stare initiala neinitializata (q0 = -1).");
+
+    ClosureContext context{ nfa, {}, nfa.getF() };
+    for (const auto& entry : nfa.getDelta()) {
+        if (entry.first.second == lambda)
+            context.lambda_next[entry.first.first].assign(entry.second.begin(), entry.second.end());
+        else
+            context.important.insert(entry.first.first);
+    }
+
+    map<vector<int>, int> stateIndex;
+    vector<vector<int>> stateThreads;   // starile AFN ale firelor, in ordinea prioritatii
+    vector<vector<int>> threadRows;     // randul de registre al fiecarui fir
+
+    //firele cu acelasi rand sursa si aceleasi etichete primesc acelasi rand (numerotat in ordinea aparitiei)
+    auto assignRows = [](const vector<Thread>& threads, const vector<int>& sourceRows,
+        vector<int>& rows, TagTransition& transition) {
+        map<pair<int, vector<int>>, int> rowIndex;
+        rows.clear();
+        for (const Thread& thread : threads) {
+            int sourceRow = thread.origin < 0 ? -1 : sourceRows[thread.origin];
+            auto inserted = rowIndex.emplace(make_pair(sourceRow, thread.tags), (int)rowIndex.size());
+            if (inserted.second) {
+                transition.source.push_back(sourceRow);
+                transition.ops_begin.push_back((int)transition.tags.size());
+                transition.tags.insert(transition.tags.end(), thread.tags.begin(), thread.tags.end());
+            }
+            rows.push_back(inserted.first->second);
+        }
+        transition.ops_begin.push_back((int)transition.tags.size());
+    };
+
+    //starea e identificata de lista ordonata a starilor AFN (aceleasi stari in alta ordine = alta
+    //prioritate) impreuna cu impartirea firelor pe randuri
+    auto intern = [&](const vector<Thread>& threads, vector<int>&& rows, int rowCount) {
+        vector<int> key;
+        for (const Thread& thread : threads)
+            key.push_back(thread.state);
+        key.insert(key.end(), rows.begin(), rows.end());
+
+        auto found = stateIndex.find(key);
+        if (found != stateIndex.end())
+            return found->second;
+        if (stateThreads.size() >= maxStates)
+            throw runtime_error("Automatul etichetat depaseste " + to_string(maxStates) + " stari.");
+
+        int id = (int)stateThreads.size();
+        int finalRow = -1;
+        for (size_t i = 0; i < threads.size() && finalRow == -1; ++i)
+            if (nfa.getF().count(threads[i].state))
+                finalRow = rows[i];
+
+        stateIndex.emplace(std::move(key), id);
+        vector<int> states;
+        for (const Thread& thread : threads)
+            states.push_back(thread.state);
+        stateThreads.push_back(std::move(states));
+        threadRows.push_back(std::move(rows));
+        row_count.push_back(rowCount);
+        final_row.push_back(finalRow);
+        transition_index.resize(transition_index.size() + 256, -1);
+        return id;
+    };
+
+    vector<int> path, rows;
+    set<int> visited;
+    vector<Thread> threads;
+    closure(context, nfa.getQ0(), -1, path, visited, threads);
+    initial = TagTransition();
+    assignRows(threads, {}, rows, initial);
+    start_state = intern(threads, std::move(rows), (int)initial.source.size());
+    initial.target = start_state;
+
+    for (size_t current = 0; current < stateThreads.size(); ++current) {
+        vector<int> sourceStates = stateThreads[current];
+        vector<int> sourceRows = threadRows[current];
+        for (char symbol : nfa.getSigma()) {
+            visited.clear();
+            threads.clear();
+            for (size_t i = 0; i < sourceStates.size(); ++i) {
+                auto moves = nfa.getDelta().find({ sourceStates[i], symbol });
+                if (moves == nfa.getDelta().end())
+                    continue;
+                for (int target : moves->second)
+                    if (!visited.count(target))
+                        closure(context, target, (int)i, path, visited, threads);
+            }
+            if (threads.empty())
+                continue;
+
+            TagTransition transition;
+            assignRows(threads, sourceRows, rows, transition);
+            transition.target = intern(threads, std::move(rows), (int)transition.source.size());
+            transition_index[current * 256 + (unsigned char)symbol] = (int)transitions.size();
+            transitions.push_back(std::move(transition));
+        }
+    }
+}
+
+bool TaggedDeterministicAutomaton::match(const string& word, vector<Submatch>& groups) const {
+    const int width = tag_count;
+    vector<int> current((size_t)row_count[start_state] * width, -1);
+    vector<int> next;
+
+    for (int j = 0; j < row_count[start_state]; ++j)
+        for (int k = initial.ops_begin[j]; k < initial.ops_begin[j + 1]; ++k)
+            current[(size_t)j * width + initial.tags[k]] = 0;
+
+    int state = start_state;
+    for (size_t pos = 0; pos < word.size(); ++pos) {
+        int index = transition_index[(size_t)state * 256 + (unsigned char)word[pos]];
+        if (index < 0)
+            return false;
+
+        const TagTransition& transition = transitions[index];
+        int rows = row_count[transition.target];
+        if (width) {
+            //fiecare rand nou mosteneste registrele randului sursa si le suprascrie pe cele atinse
+            next.resize((size_t)rows * width);
+            for (int j = 0; j < rows; ++j) {
+                const int* from = &current[(size_t)transition.source[j] * width];
+                int* to = &next[(size_t)j * width];
+                copy(from, from + width, to);
+                for (int k = transition.ops_begin[j]; k < transition.ops_begin[j + 1]; ++k)
+                    to[transition.tags[k]] = (int)pos + 1;
+            }
+            current.swap(next);
+        }
+        state = transition.target;
+    }
+
+    int winner = final_row[state];
+    if (winner < 0)
+        return false;
+
+    groups.assign(group_count + 1, Submatch());
+    groups[0] = { 0, (int)word.size() };
+    for (int g = 0; g < group_count; ++g) {
+        int start = current[(size_t)winner * width + 2 * g];
+        int end = current[(size_t)winner * width + 2 * g + 1];
+        if (start != -1 && end != -1 && start <= end)
+            groups[g + 1] = { start, end };
+    }
+    return true;
+}
+
+bool TaggedDeterministicAutomaton::checkWord(const string& word) const {
+    int state = start_state;
+    for (char c : word) {
+        int index = transition_index[(size_t)state * 256 + (unsigned char)c];
+        if (index < 0)
+            return false;
+        state = transitions[index].target;
+    }
+    return final_row[state] >= 0;
+}
+
+int TaggedDeterministicAutomaton::groupCount() const {
+    return group_count;
+}
+
+size_t TaggedDeterministicAutomaton::stateCount() const {
+    return row_count.size();
+}
@@ -0,0 +1,52 @@
+#pragma once
+#include <string>
+#include <vector>
+#include "NondeterministicFiniteAutomaton.h"
+
+using namespace std;
+
+// pozitiile unui grup in cuvant: [start, end); -1 daca grupul nu a participat la potrivire
+struct Submatch {
+    int start = -1;
+    int end = -1;
+};
+
+// AFD etichetat (Laurikari): o stare este o lista ordonata de fire ale AFN-ului. Firele care
+// au aceeasi istorie de etichete impart un rand de registre, iar fiecare tranzitie spune din
+// ce rand vine fiecare rand nou si ce etichete (inceput/sfarsit de grup) a atins pe drum.
+// Potrivirea copiaza doar randurile, intr-o singura trecere prin cuvant. Ordinea firelor este
+// prioritatea: alternativa din stanga si repetitia cat mai lunga castiga (ca la potrivirea
+// prin backtracking a intregului cuvant).
+class TaggedDeterministicAutomaton
+{
+private:
+    struct TagTransition {
+        int target;
+        vector<int> source;       // pentru fiecare rand de registre al tintei: randul sursa
+        vector<int> ops_begin;    // etichetele randului j: tags[ops_begin[j], ops_begin[j + 1])
+        vector<int> tags;
+    };
+
+    int group_count;
+    int tag_count;
+    int start_state;
+    vector<int> row_count;        // cate randuri de registre are fiecare stare
+    vector<int> final_row;        // randul primului fir final, -1 daca starea nu accepta
+    vector<int> transition_index; // state * 256 + octet -> indice in transitions, -1 = respins
+    vector<TagTransition> transitions;
+    TagTransition initial;        // etichetele atinse inainte de primul caracter
+
+public:
+    static constexpr size_t defaultMaxStates = 10000;
+
+    // arunca runtime_error daca determinizarea depaseste maxStates stari
+    TaggedDeterministicAutomaton(const NondeterministicFiniteAutomaton& nfa, int groupCount,
+        size_t maxStates = defaultMaxStates);
+
+    // groups[0] este tot cuvantul, groups[g] grupul g (numerotat dupa paranteza deschisa)
+    bool match(const string& word, vector<Submatch>& groups) const;
+    bool checkWord(const string& word) const;
+
+    int groupCount() const;
+    size_t stateCount() const;
+};